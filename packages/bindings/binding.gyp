@@ -39,7 +39,7 @@
         'fetch_libseekdb',
         '<!(node -p "require(\'node-addon-api\').targets"):node_addon_api_except_all',
       ],
-      'sources': ['src/seekdb_js_bindings.cpp'],
+      'sources': ['src/seekdb_js_bindings.cpp', 'src/seekdb_bm25.cpp', 'src/seekdb_vector.cpp'],
       'include_dirs': ['<(module_root_dir)/libseekdb'],
       'conditions': [
         ['OS=="linux" and target_arch=="x64"', {
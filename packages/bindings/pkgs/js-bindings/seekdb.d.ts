@@ -5,6 +5,10 @@
  * - Database -> SeekdbDatabase (wrapper)
  * - Connection -> SeekdbConnection (wrapper, uses SeekdbHandle from C API)
  * - Result -> SeekdbResultWrapper (wrapper, uses SeekdbResult from C API)
+ * - Statement -> SeekdbStatement (analyzed SQL bound to a connection)
+ * - Cursor -> SeekdbResultWrapper (open result of execute_stream())
+ * - Pool -> SeekdbPoolHandle (connection pool; execute() leases one connection per query)
+ * - Transaction -> SeekdbTransactionHandle (explicit transaction pinned to one connection)
  *
  * C API types (from seekdb.h):
  * - SeekdbHandle - Connection handle
@@ -28,28 +32,409 @@ export interface Connection {
   // Opaque type - internal handle
 }
 
+/**
+ * Connection pool handle - opaque type returned by create_pool()
+ * Corresponds to SeekdbPoolHandle in C++ bindings.
+ * Accepted wherever a Connection is (execute, prepare, execute_stream).
+ */
+export interface Pool {
+  // Opaque type - internal handle
+}
+
+/**
+ * Transaction handle - opaque type returned by begin()
+ * Corresponds to SeekdbTransactionHandle in C++ bindings.
+ * Accepted by execute, execute_batch, execute_stream, bulk_insert and hybrid_search, which then
+ * run on the transaction's connection. Rejected once commit() or rollback() was called.
+ */
+export interface Transaction {
+  // Opaque type - internal handle
+}
+
+/**
+ * Options for create_pool()
+ */
+export interface PoolOptions {
+  /** Connections opened immediately and kept open (default 0) */
+  min?: number;
+  /** Maximum open connections; queries beyond this wait for a free one (default 4) */
+  max?: number;
+  /** Idle connections above min are closed after this many ms (default 60000) */
+  idleTimeoutMs?: number;
+  /** Statements run on every new connection; failures are ignored */
+  initSql?: string[];
+}
+
+/**
+ * Options for configure()
+ */
+export interface ExecutorOptions {
+  /**
+   * Native threads running queries (default 4). 0 keeps using the libuv
+   * threadpool shared with fs/dns/zlib.
+   */
+  threads?: number;
+  /** Queries that may wait for a thread; further ones reject (default 1024) */
+  queueDepth?: number;
+}
+
+/**
+ * Pool usage snapshot returned by pool_stats()
+ */
+export interface PoolStats {
+  /** Open connections (idle + in use) */
+  total: number;
+  idle: number;
+  inUse: number;
+  /** Queries currently waiting for a connection */
+  waiters: number;
+  /** Connections opened over the pool's lifetime */
+  created: number;
+  /** Successful leases */
+  acquired: number;
+  /** Leases that had to wait */
+  waited: number;
+  totalWaitMs: number;
+  maxWaitMs: number;
+}
+
+/**
+ * Prepared statement handle - opaque type returned by prepare()
+ * Corresponds to SeekdbStatement in C++ bindings.
+ * Keeps its connection or pool alive; execute_prepared() throws once the connection is disconnected.
+ */
+export interface Statement {
+  // Opaque type - internal handle
+}
+
+/**
+ * Cursor handle - opaque type returned by execute_stream()
+ * Corresponds to SeekdbResultWrapper in C++ bindings (the open C API result)
+ */
+export interface Cursor {
+  // Opaque type - internal handle
+}
+
 /**
  * Query result - contains rows and column information
  * Corresponds to SeekdbResultWrapper in C++ bindings
  */
 export interface Result {
-  /** Array of rows, where each row is an array of values */
-  rows: any[][];
+  /**
+   * Array of rows: each row is an array of values, or a { column: value } object
+   * when executed with rowMode "object".
+   * VECTOR cells are Float32Array when executed with vectorFormat "float32".
+   */
+  rows: any[];
   /** Array of column names */
   columns: string[];
+  /** Present when executed with timing: true */
+  timing?: QueryTiming;
+  /** Present when executed with fields: true; one entry per column */
+  fields?: FieldInfo[];
+  /**
+   * Present when the result went past maxResultBytes with onLimit "cursor":
+   * the remaining rows, read with fetch_next()
+   */
+  cursor?: Cursor;
+}
+
+/**
+ * Column metadata of a Result (execute options fields: true), from the engine's SeekdbField
+ */
+export interface FieldInfo {
+  name: string;
+  /**
+   * SeekdbFieldType: TINY=1, SHORT=2, LONG=3, LONGLONG=4, FLOAT=5, DOUBLE=6, STRING=11,
+   * BLOB=12, VECTOR=40 (or 13); null when the engine returned no field information
+   */
+  type: number | null;
+  /** Declared display length */
+  length: number;
+  /** Column flags bitmask (NOT NULL, primary key, unsigned, binary, ...) */
+  flags: number;
+}
+
+/**
+ * Text or VECTOR cell of at least lazyColumns bytes, decoded into a JS value only on read().
+ * Holds just its own native payload, so dropping it frees that payload.
+ */
+export interface LazyCell {
+  /** Payload size in bytes (UTF-8 text, or 4 bytes per float) */
+  byteLength: number;
+  /**
+   * Decode the cell: a string (cut at the last UTF-8 character within maxBytes), or a
+   * Float32Array for VECTOR cells executed with vectorFormat "float32" (maxBytes is ignored).
+   * Unlike String cells, jsonColumns are not parsed.
+   */
+  read(maxBytes?: number): string | Float32Array;
+}
+
+/**
+ * Where one execute() spent its time (execute options timing: true)
+ */
+export interface QueryTiming {
+  /** Queued until running with a connection (threadpool wait and pool lease) */
+  queueMs: number;
+  /** seekdb_query / seekdb_query_with_params */
+  engineMs: number;
+  /** Row fetch and decode on the worker thread */
+  fetchMs: number;
+  /** Worker done until the JS result was built */
+  materializeMs: number;
+  totalMs: number;
+  rows: number;
+  /** String/VECTOR cell bytes decoded */
+  bytes: number;
+  /** 2MB re-reads of NULL/unknown-length cells */
+  fallbackReads: number;
+}
+
+/**
+ * Cumulative latency histogram of QueryStats.
+ * buckets[i] counts samples below bucketBoundsMs[i] (and at or above the previous bound).
+ */
+export interface LatencyHistogram {
+  count: number;
+  totalMs: number;
+  maxMs: number;
+  /** Quantile estimates: bucket upper bound, capped at maxMs */
+  p50Ms: number;
+  p95Ms: number;
+  p99Ms: number;
+  buckets: number[];
+}
+
+/**
+ * Cumulative execute() statistics of a connection or pool, returned by stats()
+ */
+export interface QueryStats {
+  queries: number;
+  errors: number;
+  rows: number;
+  bytes: number;
+  fallbackReads: number;
+  queue: LatencyHistogram;
+  engine: LatencyHistogram;
+  fetch: LatencyHistogram;
+  materialize: LatencyHistogram;
+  total: LatencyHistogram;
+  /** Upper bounds (ms) of the histogram buckets: powers of two microseconds, last is Infinity */
+  bucketBoundsMs: number[];
+}
+
+/**
+ * Query result of rowMode "columnar" - one value array per column instead of rows.
+ * Integer/double columns are a Float64Array (null cells are NaN, booleans 0/1);
+ * other columns are plain arrays of cell values.
+ */
+export interface ColumnarResult {
+  /** Array of column names */
+  columns: string[];
+  /** Values keyed by column name (a later duplicate column name wins) */
+  data: Record<string, Float64Array | any[]>;
+}
+
+/**
+ * Per-call options for execute()
+ */
+export interface ExecuteOptions {
+  /**
+   * How VECTOR columns are returned: "string" (default) keeps the JSON text
+   * (e.g. "[1,2,3]"); "float32" decodes it natively into a Float32Array.
+   */
+  vectorFormat?: "string" | "float32";
+  /**
+   * Row shape: "array" (default) or "object", built natively with column-name keys
+   * created once per result (a later duplicate column name wins).
+   * "columnar" returns a ColumnarResult instead of rows (fetch_next() batches too).
+   */
+  rowMode?: "array" | "object" | "columnar";
+  /** Columns whose string cells are JSON.parse'd natively (e.g. metadata); invalid JSON rejects */
+  jsonColumns?: string[];
+  /**
+   * Abort the statement: a queued execute never runs, a running one is stopped with
+   * KILL QUERY. The promise rejects with an Error named "AbortError". Pool or pooled
+   * Transaction only, since KILL QUERY acts on the whole session.
+   */
+  signal?: AbortSignal;
+  /** Per-statement timeout in ms, applied as the session's ob_query_timeout (Pool or pooled Transaction only) */
+  timeoutMs?: number;
+  /** Attach this query's QueryTiming to the result (stats() are collected either way) */
+  timing?: boolean;
+  /**
+   * Budget in bytes for one decoded result (cell payloads plus per-cell bookkeeping). The row
+   * that goes past it is the last one decoded; execute_stream() ends each batch there instead.
+   */
+  maxResultBytes?: number;
+  /**
+   * Past maxResultBytes: "error" (default) rejects; "cursor" resolves with the rows decoded
+   * so far and result.cursor for the rest (absent when the last row crossed the budget)
+   */
+  onLimit?: "error" | "cursor";
+  /** Return text/VECTOR cells of at least this many bytes as LazyCell instead of values */
+  lazyColumns?: number;
+  /** Attach per-column FieldInfo to the result (also for empty results) */
+  fields?: boolean;
+}
+
+/**
+ * Options for execute_stream()
+ */
+export interface StreamOptions extends ExecuteOptions {
+  /** Rows per fetch_next() batch (default 1000) */
+  batchSize?: number;
+}
+
+/**
+ * One statement of an execute_batch() call
+ */
+export interface BatchStatement {
+  sql: string;
+  params?: any[];
+}
+
+/**
+ * Options for execute_batch()
+ */
+export interface BatchOptions extends ExecuteOptions {
+  /** Wrap the statements in BEGIN/COMMIT; ROLLBACK on the first failure */
+  transactional?: boolean;
+}
+
+/**
+ * Options for hybrid_search()
+ */
+export interface HybridSearchOptions
+  extends Pick<ExecuteOptions, "vectorFormat" | "jsonColumns" | "maxResultBytes"> {
+  rowMode?: "array" | "object";
+  /** Only generate and validate the search SQL; rows stay empty */
+  generateOnly?: boolean;
+}
+
+/**
+ * Result of hybrid_search()
+ */
+export interface HybridSearchResult extends Result {
+  /** Validated SQL returned by DBMS_HYBRID_SEARCH.GET_SQL, or null if it returned none */
+  sql: string | null;
+}
+
+/**
+ * Progress event of open_async()/close_async()
+ */
+export interface LifecycleEvent {
+  /**
+   * "opening" | "ready" (engine started) | "joined" (engine already running) for open_async();
+   * "closing" | "closed" (engine shut down) | "released" (still used elsewhere) for close_async()
+   */
+  phase: "opening" | "ready" | "joined" | "closing" | "closed" | "released";
+  /** Milliseconds since the call started */
+  elapsedMs: number;
+}
+
+/**
+ * Options for close_async()
+ */
+export interface LifecycleOptions {
+  /** Called on the main thread as the worker passes each phase */
+  onProgress?: (event: LifecycleEvent) => void;
+}
+
+/**
+ * Options for open_async()
+ */
+export interface OpenOptions extends LifecycleOptions {
+  /** Open with seekdb_open_with_service(); port > 0 runs in server mode */
+  port?: number;
+}
+
+/**
+ * Column of a bulk_insert() call
+ */
+export interface BulkInsertColumn {
+  name: string;
+  /** Bind as CAST(? AS BINARY) (collection _id columns) */
+  binaryId?: boolean;
+  /**
+   * Overwrite this column when the row's key already exists: any update column turns each
+   * chunk into INSERT ... ON DUPLICATE KEY UPDATE col = VALUES(col), ...
+   */
+  update?: boolean;
+}
+
+/**
+ * Options for bulk_insert()
+ */
+export interface BulkInsertOptions {
+  /** Rows per INSERT statement (default 1000; lowered for very wide tables) */
+  chunkSize?: number;
+  /** Wrap all chunks in BEGIN/COMMIT; ROLLBACK on the first failure */
+  transactional?: boolean;
+}
+
+/** Numeric typed arrays accepted as bulk_insert() column data */
+export type BulkNumericArray =
+  | Int8Array
+  | Uint8Array
+  | Uint8ClampedArray
+  | Int16Array
+  | Uint16Array
+  | Int32Array
+  | Uint32Array
+  | Float32Array
+  | Float64Array;
+
+/**
+ * Parameters of bm25_encode(); defaults match @seekdb/bm25
+ */
+export interface Bm25Options {
+  k?: number;
+  b?: number;
+  avgDocLength?: number;
+  tokenMaxLength?: number;
+  maxDimension?: number;
+  /** Lowercase stopwords (default: the @seekdb/bm25 English list) */
+  stopwords?: string[];
 }
 
 /**
  * Open a seekdb database
  * @param db_dir - Database directory path (optional, defaults to current directory)
  * @returns Database handle
- * @throws Error if database cannot be opened
+ * @throws Error if database cannot be opened, or the process already runs the engine on another directory
+ * @note The engine is process-wide and refcounted: opening the same directory again (also from a
+ *   worker thread) joins the running engine instead of failing
  */
 export function open(db_dir?: string): Database;
 
 /**
- * Close a seekdb database synchronously
+ * Open a seekdb database on a worker thread, so a slow cold start does not block the event loop
+ * @param db_dir - Database directory path (optional, defaults to current directory)
+ * @param options - Optional service port and progress callback
+ * @returns Promise that resolves with the database handle
+ * @note Same process-wide sharing rules as open()
+ */
+export function open_async(
+  db_dir?: string,
+  options?: OpenOptions
+): Promise<Database>;
+
+/**
+ * Release a database handle on a worker thread
+ * @param database - Database handle returned from open() or open_async()
+ * @param options - Optional progress callback
+ * @returns Promise that resolves true if this was the last reference and the engine was shut down
+ */
+export function close_async(
+  database: Database,
+  options?: LifecycleOptions
+): Promise<boolean>;
+
+/**
+ * Release a database handle synchronously
  * @param database - Database handle returned from open()
+ * @note The engine is closed only when no other handle or connection, in any thread, still uses it
  */
 export function close_sync(database: Database): void;
 
@@ -73,17 +458,262 @@ export function connect(
  */
 export function disconnect(connection: Connection): void;
 
+/**
+ * Run queries (execute, execute_batch, bulk_insert, fetch_next) on a dedicated native
+ * thread pool instead of the libuv threadpool. Process-wide: call it once before the first
+ * query; repeating the same options is a no-op, different ones throw.
+ * Engine open/close and KILL QUERY for aborted queries stay on the libuv threadpool.
+ * @param options - Thread count and submission queue depth
+ * @throws Error if the executor is already running with other options
+ */
+export function configure(options: ExecutorOptions): void;
+
+/**
+ * Cumulative execute()/execute_prepared()/execute_stream() statistics of a connection or pool
+ * @param connection - Connection handle, Pool or Transaction (the stats of its connection or pool)
+ * @param reset - Clear the statistics after reading them
+ */
+export function stats(
+  connection: Connection | Pool | Transaction,
+  reset?: boolean
+): QueryStats;
+
+/**
+ * BM25-encode texts on a worker thread into the sparse literals ("{id:weight,...}") that
+ * @seekdb/bm25 followed by serializeSparseVector() produces
+ * @param texts - Documents to encode
+ * @param options - BM25 parameters
+ * @returns One literal per text; null for texts with non-ASCII characters, which are left to
+ *   the JS encoder (its Unicode tokenization is not reproduced natively)
+ */
+export function bm25_encode(
+  texts: string[],
+  options?: Bm25Options
+): Promise<(string | null)[]>;
+
+/** Distance functions of vector queries (l2_distance, cosine_distance, inner_product) */
+export type VectorMetric = "l2" | "cosine" | "inner_product";
+
+/**
+ * Index of the first NaN or infinite element of data, or -1 when all are finite
+ * @note The vector_* kernels run synchronously with AVX-512/AVX2 (x64) or NEON (arm64)
+ */
+export function vector_find_non_finite(data: Float32Array): number;
+
+/**
+ * L2-normalize vectors in place; zero vectors are left as is
+ * @param vectors - Concatenated vectors, dimension floats each
+ * @returns vectors
+ */
+export function vector_normalize(
+  vectors: Float32Array,
+  dimension: number
+): Float32Array;
+
+/**
+ * Distance from query to each vector, as the engine computes it: l2 is Euclidean, cosine is
+ * 1 - cos (NaN when either vector is zero), inner_product is the dot product
+ * @param vectors - Concatenated vectors of query.length floats each
+ */
+export function vector_distances(
+  metric: VectorMetric,
+  query: Float32Array,
+  vectors: Float32Array
+): Float64Array;
+
+/** Instruction set the vector_* kernels use: "avx512f", "avx2", "neon" or "scalar" */
+export function vector_isa(): string;
+
 /**
  * Execute a SQL query asynchronously
- * @param connection - Connection handle returned from connect()
+ * @param connection - Connection handle returned from connect(), a Pool or a Transaction
  * @param sql - SQL query string (may contain ? placeholders for parameters)
- * @param params - Optional array of parameters to replace ? placeholders
+ * @param params - Optional array of parameters to replace ? placeholders.
+ *   A Float32Array is bound as a VECTOR value; a Buffer, Uint8Array or ArrayBuffer is
+ *   bound in place as BLOB (no copy), so it must not be modified until the promise settles.
+ * @param options - Optional per-call options
  * @returns Promise that resolves with query results
  * @throws Error if query execution fails
  * @note Column name inference is handled automatically by C ABI layer
+ * @note SQL analysis (placeholder types, vector query detection) is cached per
+ *   connection by SQL text, so repeated statements are not re-analyzed
  */
 export function execute(
-  connection: Connection,
+  connection: Connection | Pool | Transaction,
+  sql: string,
+  params: any[] | undefined,
+  options: ExecuteOptions & { rowMode: "columnar" }
+): Promise<ColumnarResult>;
+export function execute(
+  connection: Connection | Pool | Transaction,
   sql: string,
-  params?: any[]
+  params?: any[],
+  options?: ExecuteOptions
+): Promise<Result>;
+
+/**
+ * Execute several statements in order on one connection in a single worker hop
+ * @param connection - Connection handle returned from connect(), a Pool or a Transaction
+ * @param statements - Statements to run, each with optional parameters
+ * @param options - Optional batch options (transactional, vectorFormat)
+ * @returns Promise that resolves with one result per statement
+ * @throws Error naming the failing statement index; later statements are not run
+ */
+export function execute_batch(
+  connection: Connection | Pool | Transaction,
+  statements: BatchStatement[],
+  options?: BatchOptions
+): Promise<Result[]>;
+
+/**
+ * Run a hybrid search in a single worker hop on one connection: SET @search_parm, call
+ * DBMS_HYBRID_SEARCH.GET_SQL(table, @search_parm), validate the returned SQL (one SELECT, no
+ * data-changing or file-access keywords) and execute it
+ * @param connection - Connection handle returned from connect(), a Pool or a Transaction
+ * @param table - Collection table name
+ * @param searchParm - search_parm JSON
+ * @param options - Optional row options, or generateOnly to skip the final query
+ * @returns Promise that resolves with the rows (empty if GET_SQL returned no SQL) and the SQL
+ * @throws Error if a step fails or the generated SQL does not validate
+ */
+export function hybrid_search(
+  connection: Connection | Pool | Transaction,
+  table: string,
+  searchParm: string,
+  options?: HybridSearchOptions
+): Promise<HybridSearchResult>;
+
+/**
+ * Insert rows given column by column, issuing chunked multi-row INSERTs on one worker
+ * @param connection - Connection handle returned from connect(), a Pool or a Transaction
+ * @param table - Table name
+ * @param columns - Column names (or descriptors), one per data entry
+ * @param data - One array per column, all of the same length. Array cells follow the execute()
+ *   param rules (a Float32Array cell is a VECTOR value); a numeric typed array is a numeric column.
+ * @param options - Optional chunking and transaction options
+ * @returns Promise that resolves with the number of rows inserted (or upserted)
+ * @throws Error naming the failing row range; earlier chunks stay unless transactional
+ */
+export function bulk_insert(
+  connection: Connection | Pool | Transaction,
+  table: string,
+  columns: (string | BulkInsertColumn)[],
+  data: (any[] | BulkNumericArray)[],
+  options?: BulkInsertOptions
+): Promise<number>;
+
+/**
+ * Prepare a SQL statement for repeated execution on a connection
+ * @param connection - Connection handle returned from connect(), or a Pool (not a Transaction)
+ * @param sql - SQL query string (may contain ? placeholders for parameters)
+ * @returns Statement handle
+ */
+export function prepare(connection: Connection | Pool, sql: string): Statement;
+
+/**
+ * Execute a prepared statement asynchronously
+ * @param statement - Statement handle returned from prepare()
+ * @param params - Optional array of parameters to replace ? placeholders
+ * @param options - Optional per-call options
+ * @returns Promise that resolves with query results
+ * @throws Error if the statement's connection is disconnected or query execution fails
+ */
+export function execute_prepared(
+  statement: Statement,
+  params?: any[],
+  options?: ExecuteOptions
 ): Promise<Result>;
+
+/**
+ * Execute a SQL query and keep its result open for batched reads
+ * @param connection - Connection handle returned from connect(), a Pool or a Transaction
+ * @param sql - SQL query string (may contain ? placeholders for parameters)
+ * @param params - Optional array of parameters to replace ? placeholders
+ * @param options - Optional stream options (batchSize, vectorFormat)
+ * @returns Promise that resolves with a cursor for fetch_next()
+ * @throws Error if query execution fails
+ */
+export function execute_stream(
+  connection: Connection | Pool | Transaction,
+  sql: string,
+  params?: any[],
+  options?: StreamOptions
+): Promise<Cursor>;
+
+/**
+ * Fetch the next batch of rows from a cursor; rows are decoded on a worker thread
+ * @param cursor - Cursor returned from execute_stream()
+ * @param batchSize - Optional override of the cursor's batchSize
+ * @returns Promise that resolves with the next rows; an empty rows array means the cursor is exhausted
+ * @throws Error if another fetch_next() on the same cursor is still pending
+ */
+export function fetch_next(cursor: Cursor, batchSize?: number): Promise<Result>;
+
+/**
+ * Release the native result of a cursor before it is garbage collected
+ * @param cursor - Cursor returned from execute_stream()
+ */
+export function close_cursor(cursor: Cursor): void;
+
+/**
+ * Create a connection pool; min connections are opened immediately
+ * @param database - Database handle returned from open()
+ * @param database_name - Name of the database to connect to
+ * @param autocommit - Whether to enable autocommit mode
+ * @param options - Optional pool sizing and per-connection init statements
+ * @returns Pool handle
+ * @throws Error if an initial connection cannot be established
+ */
+export function create_pool(
+  database: Database,
+  database_name: string,
+  autocommit: boolean,
+  options?: PoolOptions
+): Pool;
+
+/**
+ * Start a transaction. A pool leases one connection for it until commit() or rollback(); a
+ * Connection runs it on itself, so other statements on that connection join the transaction.
+ * @param connection - Connection handle returned from connect(), or a Pool
+ * @returns Promise that resolves with the transaction once BEGIN has run
+ */
+export function begin(connection: Connection | Pool): Promise<Transaction>;
+
+/**
+ * Commit a transaction; if COMMIT fails it is rolled back and the promise rejects.
+ * COMMIT runs once the transaction's statements issued before this call have completed.
+ * @param transaction - Transaction returned from begin()
+ * @throws Error if the transaction is finished or its connection is disconnected
+ */
+export function commit(transaction: Transaction): Promise<void>;
+
+/**
+ * Roll back a transaction, once its statements issued before this call have completed
+ * @param transaction - Transaction returned from begin()
+ * @note A pooled transaction that is garbage collected unfinished has its connection closed
+ *   (rolling it back) instead of returned to the pool
+ */
+export function rollback(transaction: Transaction): Promise<void>;
+
+/**
+ * Get pool usage statistics
+ * @param pool - Pool handle returned from create_pool()
+ */
+export function pool_stats(pool: Pool): PoolStats;
+
+/**
+ * Open idle connections on a worker until the pool holds `connections` (at most max), each
+ * running the pool's initSql, so the first queries do not pay for connecting. Connections
+ * above min still close after idleTimeoutMs.
+ * @param pool - Pool handle returned from create_pool()
+ * @param connections - Target number of open connections
+ * @returns Promise that resolves with the number of open connections
+ * @throws Error if the pool is closed or a connection cannot be established
+ */
+export function warm_pool(pool: Pool, connections: number): Promise<number>;
+
+/**
+ * Close a pool: idle connections close now, leased ones when their query finishes
+ * @param pool - Pool handle returned from create_pool()
+ */
+export function close_pool(pool: Pool): void;
@@ -0,0 +1,506 @@
+/*
+ * BM25 sparse-embedding kernel. Mirrors packages/embeddings/bm25/index.ts step by step; any change
+ * there (tokenizer, stemmer version, hashing, weighting) must be made here too.
+ */
+#include "seekdb_bm25.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+bool IsVowel(char c) {
+  return c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u' || c == 'y';
+}
+
+// Snowball v_WXY: vowels plus w, x and the consonant marker Y
+bool IsVowelWXY(char c) {
+  return IsVowel(c) || c == 'w' || c == 'x' || c == 'Y';
+}
+
+bool IsValidLiEnding(char c) {
+  return std::strchr("cdeghkmnrt", c) != nullptr && c != '\0';
+}
+
+bool HasVowelBefore(const std::string& w, size_t end) {
+  for (size_t i = 0; i < end; i++) {
+    if (IsVowel(w[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Position after the first vowel at or after from (Snowball `gopast v`), or npos
+size_t GopastVowel(const std::string& w, size_t from) {
+  for (size_t i = from; i < w.size(); i++) {
+    if (IsVowel(w[i])) {
+      return i + 1;
+    }
+  }
+  return std::string::npos;
+}
+
+// Position after the first non-vowel at or after from (Snowball `gopast non-v`), or npos
+size_t GopastNonVowel(const std::string& w, size_t from) {
+  for (size_t i = from; i < w.size(); i++) {
+    if (!IsVowel(w[i])) {
+      return i + 1;
+    }
+  }
+  return std::string::npos;
+}
+
+bool EndsWith(const std::string& w, const char* suffix) {
+  size_t len = std::strlen(suffix);
+  return w.size() >= len && w.compare(w.size() - len, len, suffix) == 0;
+}
+
+// Snowball shortv on w[0, end): a short syllable ends there
+bool EndsInShortSyllable(const std::string& w, size_t end) {
+  if (end >= 3 && !IsVowelWXY(w[end - 1]) && IsVowel(w[end - 2]) && !IsVowel(w[end - 3])) {
+    return true;
+  }
+  return end == 2 && !IsVowel(w[1]) && IsVowel(w[0]);
+}
+
+struct SuffixRule {
+  const char* suffix;
+  const char* replacement;
+};
+
+// Snowball `[substring] among(...)`: the rule with the longest suffix w ends with. Rules are
+// listed longest suffix first, so the first hit wins.
+template <size_t N>
+const SuffixRule* LongestSuffix(const std::string& w, const SuffixRule (&rules)[N]) {
+  for (const SuffixRule& rule : rules) {
+    if (EndsWith(w, rule.suffix)) {
+      return &rule;
+    }
+  }
+  return nullptr;
+}
+
+void ReplaceSuffix(std::string* w, const char* suffix, const char* replacement) {
+  w->replace(w->size() - std::strlen(suffix), std::string::npos, replacement);
+}
+
+const SuffixRule kException1[] = {
+  {"skis", "ski"},     {"skies", "sky"},   {"dying", "die"},  {"lying", "lie"},  {"tying", "tie"},
+  {"idly", "idl"},     {"gently", "gentl"}, {"ugly", "ugli"}, {"early", "earli"}, {"only", "onli"},
+  {"singly", "singl"}, {"sky", "sky"},     {"news", "news"},  {"howe", "howe"},  {"atlas", "atlas"},
+  {"cosmos", "cosmos"}, {"bias", "bias"},  {"andes", "andes"},
+};
+
+const char* const kException2[] = {
+  "inning", "outing", "canning", "herring", "earring", "proceed", "exceed", "succeed",
+};
+
+const SuffixRule kStep1b[] = {
+  {"eedly", "ee"}, {"ingly", ""}, {"edly", ""}, {"eed", "ee"}, {"ing", ""}, {"ed", ""},
+};
+
+const SuffixRule kStep2[] = {
+  {"ational", "ate"}, {"fulness", "ful"}, {"iveness", "ive"}, {"ization", "ize"},
+  {"ousness", "ous"}, {"tional", "tion"}, {"biliti", "ble"},  {"lessli", "less"},
+  {"entli", "ent"},   {"ation", "ate"},   {"alism", "al"},    {"aliti", "al"},
+  {"ousli", "ous"},   {"iviti", "ive"},   {"fulli", "ful"},   {"enci", "ence"},
+  {"anci", "ance"},   {"abli", "able"},   {"izer", "ize"},    {"ator", "ate"},
+  {"alli", "al"},     {"bli", "ble"},     {"ogi", "og"},      {"li", ""},
+};
+
+const SuffixRule kStep3[] = {
+  {"ational", "ate"}, {"tional", "tion"}, {"alize", "al"}, {"icate", "ic"}, {"iciti", "ic"},
+  {"ative", ""},      {"ical", "ic"},     {"ness", ""},    {"ful", ""},
+};
+
+const SuffixRule kStep4[] = {
+  {"ement", ""}, {"ance", ""}, {"ence", ""}, {"able", ""}, {"ible", ""}, {"ment", ""},
+  {"ant", ""},   {"ent", ""},  {"ism", ""},  {"ate", ""},  {"iti", ""},  {"ous", ""},
+  {"ive", ""},   {"ize", ""},  {"ion", ""},  {"al", ""},   {"er", ""},   {"ic", ""},
+};
+
+// Snowball English stemmer state: the word being stemmed and its R1/R2 region starts
+class EnglishStemmer {
+ public:
+  explicit EnglishStemmer(std::string word) : w_(std::move(word)) {}
+
+  std::string Stem() {
+    for (const SuffixRule& rule : kException1) {
+      if (w_ == rule.suffix) {
+        return rule.replacement;
+      }
+    }
+    if (w_.size() < 3) {
+      return w_;
+    }
+    Prelude();
+    MarkRegions();
+    Step1a();
+    bool exception2 = false;
+    for (const char* word : kException2) {
+      exception2 = exception2 || w_ == word;
+    }
+    if (!exception2) {
+      Step1b();
+      Step1c();
+      Step2();
+      Step3();
+      Step4();
+      Step5();
+    }
+    // Postlude: consonant Y back to y
+    if (y_found_) {
+      std::replace(w_.begin(), w_.end(), 'Y', 'y');
+    }
+    return w_;
+  }
+
+ private:
+  // Initial y, and y after a vowel, are consonants: mark them Y
+  void Prelude() {
+    if (w_[0] == 'y') {
+      w_[0] = 'Y';
+      y_found_ = true;
+    }
+    for (size_t i = 0; i + 1 < w_.size(); i++) {
+      if (IsVowel(w_[i]) && w_[i + 1] == 'y') {
+        w_[i + 1] = 'Y';
+        y_found_ = true;
+        i++;
+      }
+    }
+  }
+
+  void MarkRegions() {
+    p1_ = p2_ = w_.size();
+    size_t pos = std::string::npos;
+    for (const char* prefix : {"gener", "commun", "arsen"}) {
+      if (w_.compare(0, std::strlen(prefix), prefix) == 0) {
+        pos = std::strlen(prefix);
+        break;
+      }
+    }
+    if (pos == std::string::npos) {
+      pos = GopastVowel(w_, 0);
+      if (pos == std::string::npos || (pos = GopastNonVowel(w_, pos)) == std::string::npos) {
+        return;
+      }
+    }
+    p1_ = pos;
+    pos = GopastVowel(w_, pos);
+    if (pos == std::string::npos || (pos = GopastNonVowel(w_, pos)) == std::string::npos) {
+      return;
+    }
+    p2_ = pos;
+  }
+
+  size_t SuffixStart(const char* suffix) const { return w_.size() - std::strlen(suffix); }
+
+  void Step1a() {
+    // Apostrophe suffixes are skipped: the tokenizer never keeps apostrophes
+    if (EndsWith(w_, "sses")) {
+      ReplaceSuffix(&w_, "sses", "ss");
+    } else if (EndsWith(w_, "ied") || EndsWith(w_, "ies")) {
+      ReplaceSuffix(&w_, "ies", SuffixStart("ies") >= 2 ? "i" : "ie");
+    } else if (EndsWith(w_, "us") || EndsWith(w_, "ss")) {
+      // Unchanged
+    } else if (EndsWith(w_, "s")) {
+      size_t start = SuffixStart("s");
+      if (start >= 1 && HasVowelBefore(w_, start - 1)) {
+        w_.pop_back();
+      }
+    }
+  }
+
+  void Step1b() {
+    const SuffixRule* rule = LongestSuffix(w_, kStep1b);
+    if (!rule) {
+      return;
+    }
+    size_t start = SuffixStart(rule->suffix);
+    if (rule->replacement[0] != '\0') {
+      // eed, eedly
+      if (start >= p1_) {
+        ReplaceSuffix(&w_, rule->suffix, rule->replacement);
+      }
+      return;
+    }
+    if (!HasVowelBefore(w_, start)) {
+      return;
+    }
+    w_.erase(start);
+    if (EndsWith(w_, "at") || EndsWith(w_, "bl") || EndsWith(w_, "iz")) {
+      w_.push_back('e');
+    } else if (w_.size() >= 2 && w_[w_.size() - 1] == w_[w_.size() - 2] &&
+               std::strchr("bdfgmnprt", w_.back()) != nullptr) {
+      w_.pop_back();
+    } else if (w_.size() == p1_ && EndsInShortSyllable(w_, w_.size())) {
+      w_.push_back('e');
+    }
+  }
+
+  void Step1c() {
+    size_t last = w_.size() - 1;
+    if ((w_[last] == 'y' || w_[last] == 'Y') && last >= 2 && !IsVowel(w_[last - 1])) {
+      w_[last] = 'i';
+    }
+  }
+
+  void Step2() {
+    const SuffixRule* rule = LongestSuffix(w_, kStep2);
+    if (!rule) {
+      return;
+    }
+    size_t start = SuffixStart(rule->suffix);
+    if (start < p1_) {
+      return;
+    }
+    if (std::strcmp(rule->suffix, "ogi") == 0) {
+      if (start >= 1 && w_[start - 1] == 'l') {
+        ReplaceSuffix(&w_, rule->suffix, rule->replacement);
+      }
+    } else if (std::strcmp(rule->suffix, "li") == 0) {
+      if (start >= 1 && IsValidLiEnding(w_[start - 1])) {
+        w_.erase(start);
+      }
+    } else {
+      ReplaceSuffix(&w_, rule->suffix, rule->replacement);
+    }
+  }
+
+  void Step3() {
+    const SuffixRule* rule = LongestSuffix(w_, kStep3);
+    if (!rule) {
+      return;
+    }
+    size_t start = SuffixStart(rule->suffix);
+    if (start < p1_) {
+      return;
+    }
+    if (std::strcmp(rule->suffix, "ative") == 0 && start < p2_) {
+      return;
+    }
+    ReplaceSuffix(&w_, rule->suffix, rule->replacement);
+  }
+
+  void Step4() {
+    const SuffixRule* rule = LongestSuffix(w_, kStep4);
+    if (!rule) {
+      return;
+    }
+    size_t start = SuffixStart(rule->suffix);
+    if (start < p2_) {
+      return;
+    }
+    if (std::strcmp(rule->suffix, "ion") == 0 &&
+        !(start >= 1 && (w_[start - 1] == 's' || w_[start - 1] == 't'))) {
+      return;
+    }
+    w_.erase(start);
+  }
+
+  void Step5() {
+    size_t start = w_.size() - 1;
+    if (w_[start] == 'e') {
+      if (start >= p2_ || (start >= p1_ && !EndsInShortSyllable(w_, start))) {
+        w_.pop_back();
+      }
+    } else if (w_[start] == 'l') {
+      if (start >= p2_ && start >= 1 && w_[start - 1] == 'l') {
+        w_.pop_back();
+      }
+    }
+  }
+
+  std::string w_;
+  size_t p1_ = 0;
+  size_t p2_ = 0;
+  bool y_found_ = false;
+};
+
+uint32_t Rotl32(uint32_t x, int r) {
+  return (x << r) | (x >> (32 - r));
+}
+
+// murmur3_32 with seed 0 over the token bytes (Murmur3AbsHasher; ASCII, so charCodeAt & 0xff is the byte)
+uint32_t Murmur3(const std::string& key) {
+  const uint32_t c1 = 0xcc9e2d51;
+  const uint32_t c2 = 0x1b873593;
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(key.data());
+  size_t len = key.size();
+  size_t blocks = len & ~static_cast<size_t>(3);
+  uint32_t h1 = 0;
+
+  for (size_t i = 0; i < blocks; i += 4) {
+    uint32_t k1 = data[i] | (data[i + 1] << 8) | (data[i + 2] << 16) | (static_cast<uint32_t>(data[i + 3]) << 24);
+    k1 *= c1;
+    k1 = Rotl32(k1, 15);
+    k1 *= c2;
+    h1 ^= k1;
+    h1 = Rotl32(h1, 13);
+    h1 = h1 * 5 + 0xe6546b64;
+  }
+
+  uint32_t k1 = 0;
+  switch (len & 3) {
+    case 3:
+      k1 ^= data[blocks + 2] << 16;
+      // fallthrough
+    case 2:
+      k1 ^= data[blocks + 1] << 8;
+      // fallthrough
+    case 1:
+      k1 ^= data[blocks];
+      k1 *= c1;
+      k1 = Rotl32(k1, 15);
+      k1 *= c2;
+      h1 ^= k1;
+  }
+
+  h1 ^= static_cast<uint32_t>(len);
+  h1 ^= h1 >> 16;
+  h1 *= 0x85ebca6b;
+  h1 ^= h1 >> 13;
+  h1 *= 0xc2b2ae35;
+  h1 ^= h1 >> 16;
+  return h1;
+}
+
+// Number.prototype.toString() of a finite double: the shortest digits that round-trip, laid out
+// in fixed or exponent notation by ECMAScript's rules
+void AppendJsNumber(double value, std::string* out) {
+  if (value == 0) {
+    out->push_back('0');
+    return;
+  }
+  if (value < 0) {
+    out->push_back('-');
+    value = -value;
+  }
+  char buf[40];
+  // Round-tripping is monotonic in the digit count, so binary search the shortest one
+  int lo = 1;
+  int hi = 17;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    std::snprintf(buf, sizeof(buf), "%.*e", mid - 1, value);
+    if (std::strtod(buf, nullptr) == value) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  std::snprintf(buf, sizeof(buf), "%.*e", lo - 1, value);
+
+  std::string digits;
+  const char* p = buf;
+  for (; *p != 'e'; p++) {
+    if (*p != '.') {
+      digits.push_back(*p);
+    }
+  }
+  while (digits.size() > 1 && digits.back() == '0') {
+    digits.pop_back();
+  }
+  int k = static_cast<int>(digits.size());
+  int n = std::atoi(p + 1) + 1;  // Decimal point position
+
+  if (k <= n && n <= 21) {
+    out->append(digits);
+    out->append(n - k, '0');
+  } else if (0 < n && n <= 21) {
+    out->append(digits, 0, n);
+    out->push_back('.');
+    out->append(digits, n, std::string::npos);
+  } else if (-6 < n && n <= 0) {
+    out->append("0.");
+    out->append(-n, '0');
+    out->append(digits);
+  } else {
+    int exponent = n - 1;
+    out->push_back(digits[0]);
+    if (k > 1) {
+      out->push_back('.');
+      out->append(digits, 1, std::string::npos);
+    }
+    out->push_back('e');
+    out->push_back(exponent < 0 ? '-' : '+');
+    out->append(std::to_string(exponent < 0 ? -exponent : exponent));
+  }
+}
+
+bool IsTokenChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+}  // namespace
+
+std::string SeekdbBm25Stem(const std::string& word) {
+  return EnglishStemmer(word).Stem();
+}
+
+bool SeekdbBm25Encode(const SeekdbBm25Options& options, const std::string& text, std::string* out) {
+  for (char c : text) {
+    if (static_cast<unsigned char>(c) & 0x80) {
+      return false;
+    }
+  }
+
+  // Bm25Tokenizer: ASCII [A-Za-z0-9_] runs, lowercased; stopwords and over-long tokens dropped
+  std::vector<int64_t> ids;
+  std::string token;
+  auto flush = [&]() {
+    if (token.empty()) {
+      return;
+    }
+    if (options.stopwords.count(token) == 0 && token.size() <= options.token_max_length) {
+      std::string stemmed = SeekdbBm25Stem(token);
+      if (!stemmed.empty()) {
+        // Murmur3AbsHasher.hash: |signed 32-bit hash| (2^31 for INT32_MIN)
+        int64_t hash = static_cast<int32_t>(Murmur3(stemmed));
+        ids.push_back((hash < 0 ? -hash : hash) % options.max_dimension);
+      }
+    }
+    token.clear();
+  };
+  for (char c : text) {
+    if (IsTokenChar(c)) {
+      token.push_back(static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c));
+    } else {
+      flush();
+    }
+  }
+  flush();
+
+  out->clear();
+  out->push_back('{');
+  if (!ids.empty()) {
+    std::sort(ids.begin(), ids.end());
+    double doc_len = static_cast<double>(ids.size());
+    // volatile keeps the compiler from fusing this product into tf + ... (FMA), which would round
+    // differently from JS
+    volatile double length_norm =
+        options.k * (1 - options.b + (options.b * doc_len) / options.avg_doc_length);
+    double norm = length_norm;
+    for (size_t i = 0; i < ids.size();) {
+      size_t j = i;
+      while (j < ids.size() && ids[j] == ids[i]) {
+        j++;
+      }
+      double tf = static_cast<double>(j - i);
+      if (i > 0) {
+        out->push_back(',');
+      }
+      out->append(std::to_string(ids[i]));
+      out->push_back(':');
+      AppendJsNumber((tf * (options.k + 1)) / (tf + norm), out);
+      i = j;
+    }
+  }
+  out->push_back('}');
+  return true;
+}
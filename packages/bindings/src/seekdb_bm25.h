@@ -0,0 +1,28 @@
+/*
+ * BM25 sparse-embedding kernel: the native counterpart of @seekdb/bm25.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+// Parameters of one Bm25EmbeddingFunction (same defaults as @seekdb/bm25)
+struct SeekdbBm25Options {
+  double k = 1.2;
+  double b = 0.75;
+  double avg_doc_length = 256.0;
+  size_t token_max_length = 40;
+  int64_t max_dimension = 500000;
+  std::unordered_set<std::string> stopwords;  // Lowercase
+};
+
+// Encode text into the sparse literal "{id:weight,...}" that @seekdb/bm25 + serializeSparseVector
+// produce for it: same tokens, Snowball English stems, murmur3 ids and JS number formatting.
+// Handles ASCII text only (JS Unicode case mapping and \p{L}/\p{N} are not reproduced): returns
+// false for text with non-ASCII bytes, which the caller encodes in JS instead.
+bool SeekdbBm25Encode(const SeekdbBm25Options& options, const std::string& text, std::string* out);
+
+// Snowball English (Porter2) stem of a lowercase ASCII word
+std::string SeekdbBm25Stem(const std::string& word);
@@ -18,9 +18,20 @@
 #include <vector>
 #include <thread>
 #include <algorithm>
+#include <atomic>
 #include <climits>
+#include <cmath>
+#include <cctype>
+#include <list>
+#include <string_view>
+#include <unordered_map>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 
 #include "seekdb.h"
+#include "seekdb_bm25.h"
+#include "seekdb_vector.h"
 
 #define DEFAULT_SEEKDB_API "js-bindings"
 
@@ -28,14 +39,245 @@
 static const napi_type_tag DatabaseTypeTag = { 0x1234567890123456ULL, 0x7890123456789012ULL };
 static const napi_type_tag ConnectionTypeTag = { 0x2345678901234567ULL, 0x8901234567890123ULL };
 static const napi_type_tag ResultTypeTag = { 0x4567890123456789ULL, 0x0123456789012345ULL };
+static const napi_type_tag StatementTypeTag = { 0x5678901234567890ULL, 0x1234567890123456ULL };
+static const napi_type_tag PoolTypeTag = { 0x6789012345678901ULL, 0x2345678901234567ULL };
+static const napi_type_tag TransactionTypeTag = { 0x7890123456789012ULL, 0x3456789012345678ULL };
 
-// Database wrapper - just a marker, actual state is global in seekdb
+// Statements analyzed per connection (SeekdbStatementCache); SQLBuilder emits a small fixed set of shapes
+#define SEEKDB_STATEMENT_CACHE_SIZE 128
+
+// Process-wide registry of the embedded engine. seekdb_open()/seekdb_close() act on global state,
+// and this addon's statics are shared by every Node worker thread that loads it, so the engine is
+// refcounted here: the first open starts it, later opens of the same directory from any thread join
+// it, and seekdb_close() runs when the last database handle and connection are released.
+class SeekdbEngineRegistry {
+ public:
+  // Start the engine, or join it if it is already running on db_dir (*joined set when given)
+  static bool Open(const std::string& db_dir, bool with_service, int port, std::string* error,
+                   bool* joined = nullptr) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (joined) {
+      *joined = state.refs > 0;
+    }
+    if (state.refs > 0) {
+      if (db_dir != state.db_dir) {
+        *error = "seekdb is already open at '" + state.db_dir + "' in this process; "
+                 "all threads share one engine";
+        return false;
+      }
+      state.refs++;
+      return true;
+    }
+    const char* dir = db_dir.empty() ? nullptr : db_dir.c_str();
+    int ret = with_service ? seekdb_open_with_service(dir, port) : seekdb_open(dir);
+    if (ret != SEEKDB_SUCCESS) {
+      const char* msg = seekdb_last_error();
+      *error = msg ? msg : (with_service ? "Failed to open database with service" : "Failed to open database");
+      return false;
+    }
+    state.db_dir = db_dir;
+    state.refs = 1;
+    return true;
+  }
+
+  // Hold the running engine open (connections); returns false if it is not open
+  static bool Retain() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.refs == 0) {
+      return false;
+    }
+    state.refs++;
+    return true;
+  }
+
+  // Drop one reference; the last one closes the engine. Returns true if it did.
+  static bool Release() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.refs > 0 && --state.refs == 0) {
+      seekdb_close();
+      state.db_dir.clear();
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  struct State {
+    std::mutex mutex;
+    int refs = 0;
+    std::string db_dir;
+  };
+
+  static State& GetState() {
+    static State state;
+    return state;
+  }
+};
+
+// Database handle: one engine reference, dropped by close_sync() or when the handle is collected
 struct SeekdbDatabase {
   std::string db_dir;
+  bool open;
   
-  SeekdbDatabase(const std::string& dir) : db_dir(dir) {}
+  SeekdbDatabase(const std::string& dir) : db_dir(dir), open(true) {}
   ~SeekdbDatabase() {
-    // Database is closed globally via seekdb_close()
+    Close();
+  }
+  
+  // Returns true if this was the last engine reference and the engine was closed
+  bool Close() {
+    if (!open) {
+      return false;
+    }
+    open = false;
+    return SeekdbEngineRegistry::Release();
+  }
+};
+
+// Returns which parameter indices (0-based) correspond to CAST(? AS BINARY) (_id) placeholders.
+// C ABI expects SEEKDB_TYPE_VARBINARY_ID for those so it can right-pad/truncate to 512 bytes.
+static std::vector<bool> get_varbinary_id_param_indices(const std::string& sql, uint32_t param_count) {
+  std::vector<bool> result(param_count, false);
+  uint32_t param_index = 0;
+  const size_t sql_len = sql.size();
+  for (size_t pos = 0; pos < sql_len && param_index < param_count; ++pos) {
+    if (sql[pos] == '?') {
+      if (pos >= 5 && pos + 12 <= sql_len &&
+          sql.compare(pos - 5, 5, "CAST(") == 0 &&
+          sql.compare(pos + 1, 11, " AS BINARY)") == 0) {
+        result[param_index] = true;
+      }
+      ++param_index;
+    }
+  }
+  return result;
+}
+
+// SQL text analyzed once and reused by every execute of the same statement
+struct SeekdbStatementInfo {
+  std::string sql;
+  uint32_t placeholder_count;
+  std::vector<bool> varbinary_id_flags;  // Per placeholder: CAST(? AS BINARY) (_id)
+  bool is_vector_query;                  // Uses a distance function (store_result fallback)
+};
+
+static std::shared_ptr<const SeekdbStatementInfo> AnalyzeStatement(const std::string& sql) {
+  auto info = std::make_shared<SeekdbStatementInfo>();
+  info->sql = sql;
+  info->placeholder_count = static_cast<uint32_t>(std::count(sql.begin(), sql.end(), '?'));
+  info->varbinary_id_flags = get_varbinary_id_param_indices(sql, info->placeholder_count);
+  info->is_vector_query = (sql.find("cosine_distance") != std::string::npos ||
+                           sql.find("l2_distance") != std::string::npos ||
+                           sql.find("inner_product") != std::string::npos);
+  return info;
+}
+
+// LRU of analyzed statements keyed by SQL text. Main thread only; workers get shared_ptrs.
+class SeekdbStatementCache {
+ public:
+  explicit SeekdbStatementCache(size_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<const SeekdbStatementInfo> Get(const std::string& sql) {
+    auto it = index_.find(std::string_view(sql));
+    if (it != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return *it->second;
+    }
+    auto info = AnalyzeStatement(sql);
+    if (capacity_ == 0) {
+      return info;
+    }
+    entries_.push_front(info);
+    index_.emplace(std::string_view(info->sql), entries_.begin());  // Key points into the cached entry
+    if (entries_.size() > capacity_) {
+      index_.erase(std::string_view(entries_.back()->sql));
+      entries_.pop_back();
+    }
+    return info;
+  }
+
+ private:
+  using EntryList = std::list<std::shared_ptr<const SeekdbStatementInfo>>;
+  size_t capacity_;
+  EntryList entries_;
+  std::unordered_map<std::string_view, EntryList::iterator> index_;
+};
+
+// Latency histogram with power-of-two microsecond buckets: bucket i counts samples below
+// 2^i us (so bucket 0 is < 1us), the last bucket is unbounded. Main thread only.
+#define SEEKDB_STATS_BUCKETS 28
+
+struct SeekdbLatencyHistogram {
+  uint64_t count = 0;
+  double total_ms = 0;
+  double max_ms = 0;
+  uint64_t buckets[SEEKDB_STATS_BUCKETS] = {};
+
+  void Record(double ms) {
+    count++;
+    total_ms += ms;
+    max_ms = std::max(max_ms, ms);
+    const double us = ms * 1000;
+    size_t i = 0;
+    while (i + 1 < SEEKDB_STATS_BUCKETS && us >= static_cast<double>(1ULL << i)) {
+      i++;
+    }
+    buckets[i]++;
+  }
+
+  // Upper bound of bucket i in ms (infinite for the last bucket)
+  static double BucketBoundMs(size_t i) {
+    return i + 1 < SEEKDB_STATS_BUCKETS ? static_cast<double>(1ULL << i) / 1000 : INFINITY;
+  }
+
+  // Estimate of quantile q: upper bound of the bucket holding it, capped at the observed max
+  double Quantile(double q) const {
+    if (count == 0) {
+      return 0;
+    }
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * count)));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < SEEKDB_STATS_BUCKETS; i++) {
+      seen += buckets[i];
+      if (seen >= rank) {
+        return std::min(BucketBoundMs(i), max_ms);
+      }
+    }
+    return max_ms;
+  }
+};
+
+// Cumulative execute() statistics of one connection or pool, returned by stats().
+// Main thread only: ExecuteWorker records each query in OnOK()/OnError().
+struct SeekdbQueryStats {
+  uint64_t queries = 0;
+  uint64_t errors = 0;
+  uint64_t rows = 0;
+  uint64_t bytes = 0;           // String/VECTOR cell payload decoded
+  uint64_t fallback_reads = 0;  // 2MB re-reads for NULL/unknown-length cells
+  SeekdbLatencyHistogram queue;        // Queued -> worker running with a connection (incl. pool lease)
+  SeekdbLatencyHistogram engine;       // seekdb_query / seekdb_query_with_params
+  SeekdbLatencyHistogram fetch;        // Row fetch and decode on the worker
+  SeekdbLatencyHistogram materialize;  // Worker done -> JS result built (completion delivery + OnOK)
+  SeekdbLatencyHistogram total;
+};
+
+// Timestamps and counters of one ExecuteWorker run
+struct SeekdbQueryTiming {
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point enqueued;
+  Clock::time_point started;
+  Clock::time_point engine_done;
+  Clock::time_point decoded;
+  uint64_t rows = 0;
+  uint64_t bytes = 0;
+  uint64_t fallback_reads = 0;
+
+  static double Ms(Clock::time_point from, Clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
   }
 };
 
@@ -44,30 +286,431 @@ struct SeekdbConnection {
   SeekdbHandle handle;
   std::string db_name;
   bool autocommit;
+  SeekdbStatementCache statements;
+  SeekdbQueryStats stats;  // Main thread only
+  bool retained;  // Holds an engine reference so no thread closes the engine under this connection
+  // Worker-thread session state; atomic because several workers may run on one connection
+  std::atomic<int64_t> session_id{-1};                // CONNECTION_ID(), read by the first abortable query
+  std::atomic<int64_t> query_timeout_us{0};           // ob_query_timeout of a timeoutMs query (0: default)
+  std::atomic<int64_t> default_query_timeout_us{-1};  // Session ob_query_timeout before any timeoutMs query
   
   SeekdbConnection(SeekdbHandle h, const std::string& name, bool ac)
-    : handle(h), db_name(name), autocommit(ac) {}
+    : handle(h), db_name(name), autocommit(ac), statements(SEEKDB_STATEMENT_CACHE_SIZE),
+      retained(SeekdbEngineRegistry::Retain()) {}
   
   ~SeekdbConnection() {
     if (handle) {
       seekdb_connect_close(handle);
       handle = nullptr;
     }
+    if (retained) {
+      SeekdbEngineRegistry::Release();
+    }
+  }
+};
+
+// create_pool() options
+struct SeekdbPoolOptions {
+  uint32_t min_size = 0;
+  uint32_t max_size = 4;
+  uint64_t idle_timeout_ms = 60000;  // Idle connections above min_size are closed after this
+  std::vector<std::string> init_sql;  // Run on every new connection (best effort, errors ignored)
+};
+
+// Snapshot returned by pool_stats()
+struct SeekdbPoolStats {
+  uint32_t total;
+  uint32_t idle;
+  uint32_t in_use;
+  uint32_t waiters;
+  uint64_t created;
+  uint64_t acquired;
+  uint64_t waited;  // Acquires that had to wait for a connection
+  double total_wait_ms;
+  double max_wait_ms;
+};
+
+// Pool of connections to one database. Workers lease a connection for the duration of
+// Execute() (Acquire/Release run on worker threads), so independent queries run in parallel.
+// Idle connections above min_size are closed lazily on the next Acquire/Release.
+class SeekdbConnectionPool {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  SeekdbConnectionPool(const std::string& db_name, bool autocommit, const SeekdbPoolOptions& options)
+    : statements(SEEKDB_STATEMENT_CACHE_SIZE), db_name_(db_name), autocommit_(autocommit), options_(options) {}
+
+  ~SeekdbConnectionPool() {
+    // Workers hold the pool by shared_ptr, so nothing is leased at this point
+    for (auto& entry : idle_) {
+      delete entry.conn;
+    }
+  }
+
+  // Open min_size connections up front. Returns false and sets *error on failure.
+  bool Warm(std::string* error) {
+    std::vector<SeekdbConnection*> opened;
+    for (uint32_t i = 0; i < options_.min_size; i++) {
+      SeekdbConnection* conn = Open(error);
+      if (!conn) {
+        for (auto* c : opened) delete c;
+        return false;
+      }
+      opened.push_back(conn);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto* conn : opened) {
+      idle_.push_back({conn, Clock::now()});
+      total_++;
+      created_++;
+    }
+    return true;
+  }
+
+  // Open idle connections until the pool holds count (at most max_size). Worker thread.
+  // Connections above min_size still expire after idle_timeout_ms. Returns false and sets
+  // *error if the pool is closed or a connection fails; those opened so far stay idle.
+  bool Fill(uint32_t count, std::string* error) {
+    count = std::min(count, options_.max_size);
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+          *error = "Connection pool is closed";
+          return false;
+        }
+        if (total_ >= count) {
+          return true;
+        }
+        total_++;
+      }
+      SeekdbConnection* conn = Open(error);
+      bool closed;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed = closed_;
+        if (conn && !closed) {
+          idle_.push_back({conn, Clock::now()});
+          created_++;
+        } else {
+          total_--;
+        }
+      }
+      available_.notify_one();
+      if (!conn) {
+        return false;
+      }
+      if (closed) {
+        delete conn;
+        *error = "Connection pool is closed";
+        return false;
+      }
+    }
+  }
+
+  // Lease a connection, waiting while max_size connections are in use. Worker thread.
+  // Returns nullptr and sets *error if the pool is closed, a new connection fails or aborted
+  // returns true (checked before every wait; Interrupt() wakes waiters to re-check it).
+  SeekdbConnection* Acquire(std::string* error, const std::function<bool()>& aborted = nullptr) {
+    std::vector<SeekdbConnection*> expired;
+    SeekdbConnection* conn = nullptr;
+    const Clock::time_point start = Clock::now();
+    bool waited = false;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        if (closed_) {
+          *error = "Connection pool is closed";
+          return nullptr;
+        }
+        if (aborted && aborted()) {
+          *error = "Query aborted";
+          break;
+        }
+        CollectExpiredLocked(Clock::now(), &expired);
+        if (!idle_.empty()) {
+          conn = idle_.back().conn;  // Most recently used first; keeps the rest idle long enough to expire
+          idle_.pop_back();
+          break;
+        }
+        if (total_ < options_.max_size) {
+          total_++;
+          lock.unlock();
+          conn = Open(error);
+          lock.lock();
+          if (!conn) {
+            total_--;
+            available_.notify_one();
+            return nullptr;
+          }
+          created_++;
+          break;
+        }
+        waiters_++;
+        waited = true;
+        available_.wait(lock);
+        waiters_--;
+      }
+      if (conn) {
+        in_use_++;
+        acquired_++;
+        if (waited) {
+          double wait_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+          waited_++;
+          total_wait_ms_ += wait_ms;
+          max_wait_ms_ = std::max(max_wait_ms_, wait_ms);
+        }
+      }
+    }
+    for (auto* c : expired) delete c;
+    return conn;
+  }
+
+  // Return a leased connection. Worker thread.
+  void Release(SeekdbConnection* conn) {
+    std::vector<SeekdbConnection*> expired;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      in_use_--;
+      if (closed_) {
+        total_--;
+        expired.push_back(conn);
+      } else {
+        const Clock::time_point now = Clock::now();
+        idle_.push_back({conn, now});
+        CollectExpiredLocked(now, &expired);
+      }
+    }
+    available_.notify_one();
+    for (auto* c : expired) delete c;
+  }
+
+  // Close a leased connection instead of returning it, e.g. one left inside a transaction.
+  // Closing the session rolls back whatever it had not committed. Any thread.
+  void Discard(SeekdbConnection* conn) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      in_use_--;
+      total_--;
+    }
+    available_.notify_one();
+    delete conn;
+  }
+
+  // Wake waiting Acquires so they re-check their aborted condition. Any thread.
+  void Interrupt() {
+    {
+      // Taking the lock orders this after a waiter's check, so it cannot miss the notify
+      std::lock_guard<std::mutex> lock(mutex_);
+    }
+    available_.notify_all();
+  }
+
+  // Close idle connections now and leased ones as they are released; later Acquires fail.
+  void Close() {
+    std::vector<IdleEntry> idle;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      idle.swap(idle_);
+      total_ -= static_cast<uint32_t>(idle.size());
+    }
+    available_.notify_all();
+    for (auto& entry : idle) delete entry.conn;
+  }
+
+  SeekdbPoolStats Stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {total_, static_cast<uint32_t>(idle_.size()), in_use_, waiters_,
+            created_, acquired_, waited_, total_wait_ms_, max_wait_ms_};
+  }
+
+  SeekdbStatementCache statements;  // Main thread only (see SeekdbConnection::statements)
+  SeekdbQueryStats stats;           // Main thread only
+
+ private:
+  struct IdleEntry {
+    SeekdbConnection* conn;
+    Clock::time_point since;
+  };
+
+  SeekdbConnection* Open(std::string* error) {
+    SeekdbHandle handle = nullptr;
+    if (seekdb_connect(&handle, db_name_.c_str(), autocommit_) != SEEKDB_SUCCESS) {
+      const char* msg = seekdb_last_error();
+      *error = msg ? msg : "Failed to connect";
+      return nullptr;
+    }
+    for (const auto& sql : options_.init_sql) {
+      SeekdbResult result = nullptr;
+      if (seekdb_query(handle, sql.c_str(), &result) == SEEKDB_SUCCESS && result) {
+        seekdb_result_free(result);
+      }
+    }
+    return new SeekdbConnection(handle, db_name_, autocommit_);
+  }
+
+  // Move idle connections past idle_timeout_ms (oldest first, keeping min_size) into *expired
+  void CollectExpiredLocked(Clock::time_point now, std::vector<SeekdbConnection*>* expired) {
+    const auto timeout = std::chrono::milliseconds(options_.idle_timeout_ms);
+    size_t drop = 0;
+    while (drop < idle_.size() && total_ > options_.min_size && now - idle_[drop].since >= timeout) {
+      expired->push_back(idle_[drop].conn);
+      total_--;
+      drop++;
+    }
+    idle_.erase(idle_.begin(), idle_.begin() + drop);
+  }
+
+  const std::string db_name_;
+  const bool autocommit_;
+  const SeekdbPoolOptions options_;
+
+  std::mutex mutex_;
+  std::condition_variable available_;
+  std::vector<IdleEntry> idle_;  // Oldest first
+  uint32_t total_ = 0;
+  uint32_t in_use_ = 0;
+  uint32_t waiters_ = 0;
+  bool closed_ = false;
+  uint64_t created_ = 0;
+  uint64_t acquired_ = 0;
+  uint64_t waited_ = 0;
+  double total_wait_ms_ = 0;
+  double max_wait_ms_ = 0;
+};
+
+// Pool external: the pool is shared with in-flight workers
+struct SeekdbPoolHandle {
+  std::shared_ptr<SeekdbConnectionPool> pool;
+
+  explicit SeekdbPoolHandle(std::shared_ptr<SeekdbConnectionPool> p) : pool(std::move(p)) {}
+};
+
+// Explicit transaction started by begin(): pins one connection (leased from the pool, or the
+// connection itself) until commit()/rollback(). Shared with in-flight workers, so a pooled
+// connection goes back to the pool only once the last statement on it has finished.
+struct SeekdbTransaction {
+  std::shared_ptr<SeekdbConnectionPool> pool;  // Pool conn is leased from; null for a Connection
+  SeekdbConnection* conn = nullptr;            // Set by BeginWorker
+  SeekdbStatementCache* statements;            // Cache of the connection or pool; main thread only
+  SeekdbQueryStats* stats;                     // Stats of the connection or pool; main thread only
+  bool finished = false;  // commit() or rollback() was called (main thread only)
+  bool clean = false;     // conn is outside any transaction; written by the worker that ended it
+  // Main thread only: statements submitted on the transaction and not completed yet, and the
+  // commit()/rollback() submitted once they have drained (see SeekdbTransactionUse)
+  uint32_t in_flight = 0;
+  std::function<void()> on_drained;
+  Napi::Reference<Napi::Value> owner;  // The Connection or Pool external conn belongs to
+
+  SeekdbTransaction(std::shared_ptr<SeekdbConnectionPool> p, SeekdbConnection* c,
+                    SeekdbStatementCache* s, SeekdbQueryStats* q, Napi::Value o)
+    : pool(std::move(p)), conn(c), statements(s), stats(q),
+      owner(Napi::Reference<Napi::Value>::New(o, 1)) {}
+
+  ~SeekdbTransaction() {
+    if (pool && conn) {
+      // An abandoned transaction is closed with its session, which rolls it back
+      if (clean) {
+        pool->Release(conn);
+      } else {
+        pool->Discard(conn);
+      }
+    }
+  }
+};
+
+// Counts one in-flight statement of a transaction, from target resolution until its worker is
+// destroyed (both on the main thread). The last one out submits a pending commit()/rollback(),
+// so COMMIT never overtakes a statement issued before it.
+struct SeekdbTransactionUse {
+  std::shared_ptr<SeekdbTransaction> tx;
+
+  explicit SeekdbTransactionUse(std::shared_ptr<SeekdbTransaction> t) : tx(std::move(t)) {
+    tx->in_flight++;
+  }
+
+  ~SeekdbTransactionUse() {
+    if (--tx->in_flight == 0 && tx->on_drained) {
+      std::function<void()> on_drained = std::move(tx->on_drained);
+      tx->on_drained = nullptr;
+      on_drained();
+    }
   }
 };
 
-// Result wrapper
+// Transaction external
+struct SeekdbTransactionHandle {
+  std::shared_ptr<SeekdbTransaction> tx;
+
+  explicit SeekdbTransactionHandle(std::shared_ptr<SeekdbTransaction> t) : tx(std::move(t)) {}
+};
+
+// What a statement runs against: one connection, or a pool that leases one per worker
+struct SeekdbExecuteTarget {
+  SeekdbConnection* conn = nullptr;
+  std::shared_ptr<SeekdbConnectionPool> pool;
+  std::shared_ptr<SeekdbTransaction> transaction;  // Keeps the transaction's conn pinned while in flight
+  std::shared_ptr<SeekdbTransactionUse> transaction_use;  // Holds back commit()/rollback() meanwhile
+  SeekdbStatementCache* statements = nullptr;  // Cache of conn or pool; main thread only
+  SeekdbQueryStats* stats = nullptr;           // Stats of conn or pool; main thread only
+};
+
+// Prepared statement: analyzed SQL bound to the connection or pool it was prepared on.
+// Holds a reference to that connection's (or pool's) external, so target stays valid for as long
+// as the statement can be executed; after disconnect() execute_prepared() throws instead.
+struct SeekdbStatement {
+  SeekdbExecuteTarget target;
+  std::shared_ptr<const SeekdbStatementInfo> info;
+  Napi::Reference<Napi::Value> owner;
+
+  SeekdbStatement(SeekdbExecuteTarget t, std::shared_ptr<const SeekdbStatementInfo> i, Napi::Value o)
+    : target(std::move(t)), info(std::move(i)), owner(Napi::Reference<Napi::Value>::New(o, 1)) {}
+};
+
+// Default rows per fetch_next() batch for execute_stream()
+#define SEEKDB_DEFAULT_STREAM_BATCH_SIZE 1000
+
+// Per-call execute() options, parsed on the main thread (see ParseExecuteOptions)
+struct ExecuteOptions {
+  bool vectors_as_float32 = false;  // vectorFormat: "float32" - VECTOR cells become Float32Array
+  bool stream = false;              // execute_stream(): keep the result open as a cursor
+  int64_t batch_size = SEEKDB_DEFAULT_STREAM_BATCH_SIZE;  // execute_stream() batchSize
+  bool rows_as_objects = false;     // rowMode: "object" - rows are { column: value } objects
+  bool timing = false;              // timing: true - attach this query's QueryTiming to the result
+  bool columnar = false;            // rowMode: "columnar" - { columns, data: { column: values } }
+  std::vector<std::string> json_columns;  // jsonColumns: string cells of these columns are JSON.parse'd
+  int64_t timeout_ms = 0;           // timeoutMs: per-statement engine timeout (ob_query_timeout), 0 = none
+  uint64_t max_result_bytes = 0;    // maxResultBytes: decoded bytes per result or batch, 0 = unlimited
+  bool cursor_on_limit = false;     // onLimit: "cursor" - past maxResultBytes, return a cursor for the rest
+  size_t lazy_min_bytes = 0;        // lazyColumns: text/vector cells of this many bytes become LazyCells
+  bool fields = false;              // fields: attach per-column SeekdbField type/length/flags to results
+};
+
+struct SeekdbColumnBuffer;
+class SeekdbScratchBuffer;
+
+// Decodes cell j of row into column (worker thread); one per column, see SelectCellDecoder()
+typedef void (*SeekdbCellDecoder)(SeekdbRow row, int32_t j, SeekdbColumnBuffer& column,
+                                  SeekdbScratchBuffer& scratch, std::vector<float>& vector_scratch);
+
+// Result wrapper. Also the cursor behind execute_stream(): rows are fetched in batches by
+// FetchWorker until current_row reaches row_count.
 struct SeekdbResultWrapper {
   SeekdbResult result;
   int64_t row_count;
   int32_t column_count;
   std::vector<std::string> column_names;
   std::vector<SeekdbField*> field_info;  // Field type information for optimized type detection
-  int current_row;
+  std::vector<SeekdbCellDecoder> decoders;  // Per-column decoders, built by the first DecodeResult()
+  int64_t current_row;  // Index of the last fetched row (-1 before the first fetch)
   char** allocated_names;  // For seekdb_result_get_all_column_names_alloc()
+  ExecuteOptions options;  // Options of the execute_stream() call that opened the cursor
+  bool fetching;  // A FetchWorker is in flight (main thread only)
   
   SeekdbResultWrapper(SeekdbResult r) 
-    : result(r), row_count(0), column_count(0), current_row(-1), allocated_names(nullptr) {
+    : result(r), row_count(0), column_count(0), current_row(-1), allocated_names(nullptr),
+      fetching(false) {
     if (result) {
       // Use new API: seekdb_num_rows and seekdb_num_fields
       row_count = static_cast<int64_t>(seekdb_num_rows(result));
@@ -143,335 +786,2121 @@ struct SeekdbResultWrapper {
   }
   
   ~SeekdbResultWrapper() {
+    Release();
+  }
+
+  // Free the C ABI result; the wrapper then behaves as an exhausted cursor
+  void Release() {
     // Allocated names: caller must free
     if (allocated_names && column_count > 0) {
       seekdb_free_column_names(allocated_names, column_count);
       allocated_names = nullptr;
     }
     // field_info: pointers into result set; valid until seekdb_result_free(result), do not free
+    field_info.clear();
+    decoders.clear();
     if (result) {
       seekdb_result_free(result);
       result = nullptr;
     }
+    row_count = 0;
+    current_row = -1;
   }
 };
 
-// Helper functions to get objects from external
-template<typename T>
-T* GetFromExternal(Napi::Env env, Napi::Value value, const napi_type_tag& type_tag) {
-  if (!value.IsExternal()) {
-    throw Napi::TypeError::New(env, "Expected external object");
+// Kind of a decoded cell (see SeekdbColumnBuffer)
+enum class CellKind : uint8_t {
+  Null = 0,
+  Bool = 1,
+  Number = 2,
+  String = 3,
+  Float32Vector = 4,
+  LazyString = 5,         // Payload is lazy[numbers[i]], decoded to a string by LazyCell.read()
+  LazyFloat32Vector = 6,  // Same, decoded to a Float32Array
+};
+
+// One decoded column, filled on the worker thread.
+// Cell i is kinds[i]; numeric/bool payload is numbers[i] (NaN for null cells, so numbers can be
+// copied straight into a Float64Array); string and Float32Vector payloads are
+// bytes[offsets[i], offsets[i + 1]). offsets always has row_count + 1 entries.
+// With lazyColumns, payloads of at least lazy_min_bytes go to their own shared buffer instead, so
+// the LazyCell handed to JS can keep just that payload alive.
+struct SeekdbColumnBuffer {
+  std::vector<CellKind> kinds;
+  std::vector<double> numbers;
+  std::vector<size_t> offsets{0};
+  std::string bytes;
+  std::vector<std::shared_ptr<const std::string>> lazy;
+  size_t lazy_bytes = 0;
+  size_t lazy_min_bytes = 0;  // 0: no lazy cells; set by DecodeResult()
+  bool numeric_type = false;  // Integer/double column (field types 1-6), set by DecodeResult()
+  bool has_text = false;      // Some cell is a String/Float32Vector (e.g. a typed getter failed)
+
+  void Reserve(size_t rows) {
+    kinds.reserve(rows);
+    numbers.reserve(rows);
+    offsets.reserve(rows + 1);
   }
-  auto external = value.As<Napi::External<T>>();
-  if (!external.CheckTypeTag(&type_tag)) {
-    throw Napi::TypeError::New(env, "Invalid type tag");
+
+  void AppendNull() { Append(CellKind::Null, std::nan("")); }
+  void AppendBool(bool value) { Append(CellKind::Bool, value ? 1 : 0); }
+  void AppendNumber(double value) { Append(CellKind::Number, value); }
+  void AppendString(const char* data, size_t len) {
+    if (lazy_min_bytes > 0 && len >= lazy_min_bytes) {
+      AppendLazy(CellKind::LazyString, data, len);
+      return;
+    }
+    bytes.append(data, len);
+    has_text = true;
+    Append(CellKind::String, 0);
+  }
+  void AppendFloat32Vector(const float* data, size_t count) {
+    const size_t len = count * sizeof(float);
+    if (lazy_min_bytes > 0 && len >= lazy_min_bytes) {
+      AppendLazy(CellKind::LazyFloat32Vector, reinterpret_cast<const char*>(data), len);
+      return;
+    }
+    bytes.append(reinterpret_cast<const char*>(data), len);
+    has_text = true;
+    Append(CellKind::Float32Vector, 0);
   }
-  return external.Data();
-}
 
-SeekdbDatabase* GetDatabaseFromExternal(Napi::Env env, Napi::Value value) {
-  return GetFromExternal<SeekdbDatabase>(env, value, DatabaseTypeTag);
+  // Bookkeeping per cell (kinds, numbers, offsets), as counted against maxResultBytes
+  static constexpr size_t kCellBytes = sizeof(CellKind) + sizeof(double) + sizeof(size_t);
+
+  // Payload bytes plus per-cell bookkeeping, as counted against maxResultBytes
+  size_t MemoryBytes() const {
+    return bytes.size() + lazy_bytes + kinds.size() * kCellBytes;
+  }
+
+ private:
+  void Append(CellKind kind, double number) {
+    kinds.push_back(kind);
+    numbers.push_back(number);
+    offsets.push_back(bytes.size());
+  }
+
+  void AppendLazy(CellKind kind, const char* data, size_t len) {
+    lazy.push_back(std::make_shared<const std::string>(data, len));
+    lazy_bytes += len;
+    has_text = true;
+    Append(kind, static_cast<double>(lazy.size() - 1));
+  }
+};
+
+// SeekdbField metadata of one column, copied off the C ABI result; type -1 when the engine
+// returned no field information
+struct SeekdbFieldMeta {
+  int32_t type = -1;
+  uint64_t length = 0;
+  uint32_t flags = 0;
+};
+
+// Whole result decoded into native columnar buffers on the worker thread.
+// OnOK() only wraps these into JS values, so no C ABI row access happens on the main thread.
+struct SeekdbResultBuffer {
+  int64_t row_count = 0;
+  std::vector<std::string> column_names;
+  std::vector<SeekdbFieldMeta> fields;
+  std::vector<SeekdbColumnBuffer> columns;
+};
+
+// Reusable scratch buffer for seekdb_row_get_string, one per worker.
+// Grows on demand and is never zero-filled, so the 2MB reads for NULL / unknown-length
+// cells cost one allocation per query instead of a zero-filled 2MB vector per cell.
+class SeekdbScratchBuffer {
+ public:
+  // Returns a buffer of at least size bytes whose first byte is '\0'.
+  char* Get(size_t size) {
+    if (size > capacity_) {
+      size_t new_capacity = std::max(size, capacity_ * 2);
+      data_.reset(new char[new_capacity]);
+      capacity_ = new_capacity;
+    }
+    data_[0] = '\0';
+    return data_.get();
+  }
+
+  size_t fallback_reads = 0;  // 2MB reads of NULL/unknown-length cells (stats())
+
+ private:
+  std::unique_ptr<char[]> data_;
+  size_t capacity_ = 0;
+};
+
+// Read cell j as a C string through scratch. buf_size is the size passed to the C ABI
+// (terminator included); *out/*out_len receive the string. Returns the C ABI status.
+static int ReadCellString(SeekdbRow row, int32_t j, size_t buf_size, SeekdbScratchBuffer& scratch,
+                          const char** out, size_t* out_len) {
+  char* buf = scratch.Get(buf_size + 1);
+  buf[buf_size] = '\0';  // Past what the C ABI may write, so the length scan is always bounded
+  int ret = seekdb_row_get_string(row, j, buf, buf_size);
+  *out = buf;
+  *out_len = strnlen(buf, buf_size);
+  return ret;
 }
 
-SeekdbConnection* GetConnectionFromExternal(Napi::Env env, Napi::Value value) {
-  return GetFromExternal<SeekdbConnection>(env, value, ConnectionTypeTag);
+// VECTOR field types as reported by the C ABI
+static bool IsVectorFieldType(int32_t field_type) {
+  return field_type == 40 || field_type == 13;
 }
 
-SeekdbResultWrapper* GetResultFromExternal(Napi::Env env, Napi::Value value) {
-  return GetFromExternal<SeekdbResultWrapper>(env, value, ResultTypeTag);
+// Integer and floating point field types (TINY..DOUBLE) as reported by the C ABI
+static bool IsNumericFieldType(int32_t field_type) {
+  return field_type >= 1 && field_type <= 6;
 }
 
-// Create external objects
-template<typename T>
-Napi::External<T> CreateExternal(Napi::Env env, const napi_type_tag& type_tag, T* data) {
-  auto external = Napi::External<T>::New(env, data, [](Napi::Env, T* data) {
-    delete data;
-  });
-  external.TypeTag(&type_tag);
-  return external;
+// Parse a VECTOR text literal ("[1,2.5,3]") into out. Returns false if str is not one.
+static bool ParseVectorText(const char* str, size_t len, std::vector<float>* out) {
+  out->clear();
+  const char* p = str;
+  const char* end = str + len;
+  while (p < end && isspace(static_cast<unsigned char>(*p))) p++;
+  if (p == end || *p != '[') {
+    return false;
+  }
+  p++;
+  while (true) {
+    while (p < end && isspace(static_cast<unsigned char>(*p))) p++;
+    if (p == end) {
+      return false;
+    }
+    if (*p == ']') {
+      return true;
+    }
+    char* num_end = nullptr;
+    float value = std::strtof(p, &num_end);
+    if (num_end == p || num_end > end) {
+      return false;
+    }
+    out->push_back(value);
+    p = num_end;
+    while (p < end && isspace(static_cast<unsigned char>(*p))) p++;
+    if (p < end && *p == ',') {
+      p++;
+    } else if (p == end || *p != ']') {
+      return false;
+    }
+  }
 }
 
-// Returns which parameter indices (0-based) correspond to CAST(? AS BINARY) (_id) placeholders.
-// C ABI expects SEEKDB_TYPE_VARBINARY_ID for those so it can right-pad/truncate to 512 bytes.
-static std::vector<bool> get_varbinary_id_param_indices(const std::string& sql, uint32_t param_count) {
-  std::vector<bool> result(param_count, false);
-  uint32_t param_index = 0;
-  const size_t sql_len = sql.size();
-  for (size_t pos = 0; pos < sql_len && param_index < param_count; ++pos) {
-    if (sql[pos] == '?') {
-      if (pos >= 5 && pos + 12 <= sql_len &&
-          sql.compare(pos - 5, 5, "CAST(") == 0 &&
-          sql.compare(pos + 1, 11, " AS BINARY)") == 0) {
-        result[param_index] = true;
-      }
-      ++param_index;
+// Format a float vector as the VECTOR text literal the C ABI binds ("[1,2.5,3]").
+// %.9g round-trips every float exactly.
+static void FormatVectorText(const float* values, size_t count, std::string* out) {
+  out->clear();
+  out->reserve(count * 12 + 2);
+  out->push_back('[');
+  char num_buf[32];
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0) {
+      out->push_back(',');
     }
+    int n = snprintf(num_buf, sizeof(num_buf), "%.9g", static_cast<double>(values[i]));
+    out->append(num_buf, n > 0 ? static_cast<size_t>(n) : 0);
   }
-  return result;
+  out->push_back(']');
 }
 
-// Async worker for execute operation
-class ExecuteWorker : public Napi::AsyncWorker {
- public:
-  ExecuteWorker(Napi::Promise::Deferred deferred, SeekdbConnection* conn, const std::string& sql)
-    : Napi::AsyncWorker(deferred.Env()), deferred_(deferred), conn_(conn), sql_(sql), 
-      has_params_(false), param_count_(0), result_(nullptr) {}
-  
-  ExecuteWorker(Napi::Promise::Deferred deferred, SeekdbConnection* conn, const std::string& sql, 
-                const Napi::Array& params)
-    : Napi::AsyncWorker(deferred.Env()), deferred_(deferred), conn_(conn), sql_(sql),
-      has_params_(true), result_(nullptr) {
+// Store a VECTOR cell as Float32Vector when it is a text literal; anything else stays a string
+// so the SDK keeps its existing fallbacks.
+static void AppendVectorCell(const char* str, size_t len, SeekdbColumnBuffer& column,
+                             std::vector<float>& vector_scratch) {
+  if (ParseVectorText(str, len, &vector_scratch)) {
+    column.AppendFloat32Vector(vector_scratch.data(), vector_scratch.size());
+  } else {
+    column.AppendString(str, len);
+  }
+}
+
+// Per-column cell decoders. Which getter a cell needs depends only on its column's SeekdbField
+// type, so SelectCellDecoder() picks one of these once per result and the row loop in
+// DecodeResult() is a plain indirect call per cell. All keep the long-standing C ABI
+// workarounds: unknown-length cells are read with a 2MB buffer (long TEXT may report a bad
+// length) and strings are NUL-terminated C strings.
+
+// Cell the C ABI reports as NULL. Long TEXT may be wrongly reported as null, so try a 2MB buffer
+// first and use it if non-empty. If 2MB returns empty and str_len==0 treat as ""; if 2MB fails
+// do not fall back to 1-byte (column may be long), set null.
+static void DecodeReportedNullCell(SeekdbRow row, int32_t j, SeekdbColumnBuffer& column,
+                                   SeekdbScratchBuffer& scratch) {
+  const char* str = nullptr;
+  size_t len = 0;
+  size_t str_len = seekdb_row_get_string_len(row, j);
+  const size_t fallback_buf_size = 2 * 1024 * 1024;
+  scratch.fallback_reads++;
+  int get_ret = ReadCellString(row, j, fallback_buf_size, scratch, &str, &len);
+  if (get_ret == SEEKDB_SUCCESS && len > 0) {
+    column.AppendString(str, len);
+  } else if (get_ret == SEEKDB_SUCCESS && str_len == 0) {
+    column.AppendString("", 0);
+  } else {
+    // 2MB failed or returned empty with unknown length: do not try 1-byte (may be long content); set null
+    column.AppendNull();
+  }
+}
+
+// STRING/BLOB (11-12) and VECTOR (40/13), and typed columns whose getter failed. VECTOR may come
+// back as JSON text (vector_binary_to_json) or binary; it is returned as a string so the SDK can
+// JSON.parse it or fall back to parseEmbeddingBinaryString. AsFloat32 (vectorFormat "float32")
+// parses VECTOR text here and appends a Float32Array cell instead.
+template <bool AsFloat32>
+static void DecodeTextCell(SeekdbRow row, int32_t j, SeekdbColumnBuffer& column, SeekdbScratchBuffer& scratch,
+                           std::vector<float>& vector_scratch) {
+  const char* str = nullptr;
+  size_t len = 0;
+  size_t str_len = seekdb_row_get_string_len(row, j);
+  const size_t max_safe_len = 10 * 1024 * 1024;  // 10MB cap to avoid OOM
+  const size_t fallback_buf_size = 2 * 1024 * 1024;  // 2MB for long document/metadata
+  // When C ABI returns valid length for STRING/BLOB/VECTOR (and not 0 for long content)
+  bool read = str_len != static_cast<size_t>(-1) && str_len > 0 && str_len <= max_safe_len &&
+              ReadCellString(row, j, str_len + 1, scratch, &str, &len) == SEEKDB_SUCCESS;
+  // When C ABI returns -1 or 0 for length (e.g. long TEXT/BLOB or wrong len): try large buffer
+  if (!read) {
+    scratch.fallback_reads++;
+    read = ReadCellString(row, j, fallback_buf_size, scratch, &str, &len) == SEEKDB_SUCCESS;
+  }
+  if (!read) {
+    column.AppendNull();
+  } else if (AsFloat32) {
+    AppendVectorCell(str, len, column, vector_scratch);
+  } else {
+    column.AppendString(str, len);
+  }
+}
+
+// TINY (1): boolean, falling back to int64 and then text
+static void DecodeTinyCell(SeekdbRow row, int32_t j, SeekdbColumnBuffer& column, SeekdbScratchBuffer& scratch,
+                           std::vector<float>& vector_scratch) {
+  bool bool_val;
+  if (seekdb_row_get_bool(row, j, &bool_val) == SEEKDB_SUCCESS) {
+    column.AppendBool(bool_val);
+    return;
+  }
+  int64_t int_val;
+  if (seekdb_row_get_int64(row, j, &int_val) == SEEKDB_SUCCESS) {
+    column.AppendNumber(static_cast<double>(int_val));
+    return;
+  }
+  DecodeTextCell<false>(row, j, column, scratch, vector_scratch);
+}
+
+// SHORT, LONG, LONGLONG (2-4): int64, falling back to text
+static void DecodeIntegerCell(SeekdbRow row, int32_t j, SeekdbColumnBuffer& column, SeekdbScratchBuffer& scratch,
+                              std::vector<float>& vector_scratch) {
+  int64_t int_val;
+  if (seekdb_row_get_int64(row, j, &int_val) == SEEKDB_SUCCESS) {
+    column.AppendNumber(static_cast<double>(int_val));
+    return;
+  }
+  DecodeTextCell<false>(row, j, column, scratch, vector_scratch);
+}
+
+// FLOAT, DOUBLE (5-6): double, falling back to text
+static void DecodeDoubleCell(SeekdbRow row, int32_t j, SeekdbColumnBuffer& column, SeekdbScratchBuffer& scratch,
+                             std::vector<float>& vector_scratch) {
+  double double_val;
+  if (seekdb_row_get_double(row, j, &double_val) == SEEKDB_SUCCESS) {
+    column.AppendNumber(double_val);
+    return;
+  }
+  DecodeTextCell<false>(row, j, column, scratch, vector_scratch);
+}
+
+// No field information: read text (length first when available to support long TEXT/BLOB,
+// e.g. 100KB document) and infer numbers/booleans only for the legacy fixed-buffer path
+static void DecodeUntypedCell(SeekdbRow row, int32_t j, SeekdbColumnBuffer& column, SeekdbScratchBuffer& scratch,
+                              std::vector<float>& vector_scratch) {
+  const char* str = nullptr;
+  size_t len = 0;
+  size_t str_len = seekdb_row_get_string_len(row, j);
+  const size_t max_safe_len = 10 * 1024 * 1024;  // 10MB cap to avoid OOM
+  const size_t fallback_buf_size = 2 * 1024 * 1024;  // 2MB when length unknown
+  if (str_len != static_cast<size_t>(-1) && str_len <= max_safe_len) {
+    if (ReadCellString(row, j, str_len + 1, scratch, &str, &len) == SEEKDB_SUCCESS) {
+      column.AppendString(str, len);
+    } else {
+      column.AppendNull();
+    }
+  } else if (str_len == static_cast<size_t>(-1)) {
+    // Length unknown (e.g. long TEXT/BLOB): try large buffer so long document/metadata not truncated
+    scratch.fallback_reads++;
+    if (ReadCellString(row, j, fallback_buf_size, scratch, &str, &len) == SEEKDB_SUCCESS) {
+      column.AppendString(str, len);
+    } else {
+      column.AppendNull();
+    }
+  } else {
+    // Length > 10MB: use fixed buffer (e.g. for numeric/boolean columns or legacy path)
+    if (ReadCellString(row, j, 4096, scratch, &str, &len) != SEEKDB_SUCCESS || len == 0) {
+      column.AppendNull();
+      return;
+    }
+    std::string str_val(str, len);
+    char* end_ptr = nullptr;
+    double num_val = std::strtod(str_val.c_str(), &end_ptr);
+    if (*end_ptr == '\0' && end_ptr != str_val.c_str()) {
+      if (num_val == static_cast<int64_t>(num_val)) {
+        column.AppendNumber(static_cast<double>(static_cast<int64_t>(num_val)));
+      } else {
+        column.AppendNumber(num_val);
+      }
+    } else if (str_val == "true" || str_val == "1") {
+      column.AppendBool(true);
+    } else if (str_val == "false" || str_val == "0") {
+      column.AppendBool(false);
+    } else {
+      column.AppendString(str_val.data(), str_val.size());
+    }
+  }
+}
+
+// Pick the decoder for a column. Field types align with SeekdbFieldType enum values:
+// TINY=1, SHORT=2, LONG=3, LONGLONG=4, FLOAT=5, DOUBLE=6, STRING=11, BLOB=12, VECTOR=40/13.
+static SeekdbCellDecoder SelectCellDecoder(const SeekdbField* field, const ExecuteOptions& options) {
+  if (!field) {
+    return &DecodeUntypedCell;
+  }
+  const int32_t field_type = field->type;
+  if (field_type == 1) {
+    return &DecodeTinyCell;
+  }
+  if (field_type >= 2 && field_type <= 4) {
+    return &DecodeIntegerCell;
+  }
+  if (field_type == 5 || field_type == 6) {
+    return &DecodeDoubleCell;
+  }
+  if (options.vectors_as_float32 && IsVectorFieldType(field_type)) {
+    return &DecodeTextCell<true>;
+  }
+  return &DecodeTextCell<false>;
+}
+
+// Decoded size of a result, see SeekdbColumnBuffer::MemoryBytes()
+static size_t DecodedBytes(const SeekdbResultBuffer& buffer) {
+  size_t total = 0;
+  for (const auto& column : buffer.columns) {
+    total += column.MemoryBytes();
+  }
+  return total;
+}
+
+// Fetch and decode up to max_rows of the remaining rows of wrapper into out. Runs on the worker thread.
+// With maxResultBytes, stops after the row that takes the decoded size past it and returns true;
+// the caller fails the query, or keeps the wrapper open as a cursor if rows are left.
+static bool DecodeResult(SeekdbResultWrapper* wrapper, SeekdbResultBuffer* out, SeekdbScratchBuffer& scratch,
+                         const ExecuteOptions& options, int64_t max_rows = INT64_MAX) {
+  out->column_names.clear();
+  out->column_names.reserve(wrapper->column_names.size());
+  for (size_t i = 0; i < wrapper->column_names.size(); i++) {
+    // Ensure column name is not empty
+    const std::string& col_name = wrapper->column_names[i];
+    out->column_names.push_back(col_name.empty() ? "col_" + std::to_string(i) : col_name);
+  }
+
+  const int32_t column_count = wrapper->column_count;
+  out->fields.assign(column_count, SeekdbFieldMeta());
+  for (int32_t j = 0; j < column_count && j < static_cast<int32_t>(wrapper->field_info.size()); j++) {
+    if (const SeekdbField* field = wrapper->field_info[j]) {
+      out->fields[j].type = field->type;
+      out->fields[j].length = static_cast<uint64_t>(field->length);
+      out->fields[j].flags = static_cast<uint32_t>(field->flags);
+    }
+  }
+  out->row_count = 0;
+  out->columns.assign(column_count, SeekdbColumnBuffer());
+  if (column_count == 0) {
+    return false;
+  }
+  const int64_t remaining_rows = std::min(wrapper->row_count - (wrapper->current_row + 1), max_rows);
+  if (remaining_rows <= 0) {
+    return false;
+  }
+  // With a budget, reserve no more rows than the budget can hold; the vectors grow past that
+  size_t reserve_rows = static_cast<size_t>(remaining_rows);
+  if (options.max_result_bytes > 0) {
+    const uint64_t budget_rows =
+        options.max_result_bytes / (static_cast<uint64_t>(column_count) * SeekdbColumnBuffer::kCellBytes) + 1;
+    reserve_rows = static_cast<size_t>(std::min<uint64_t>(reserve_rows, budget_rows));
+  }
+  for (auto& column : out->columns) {
+    column.Reserve(reserve_rows);
+    column.lazy_min_bytes = options.lazy_min_bytes;
+  }
+
+  // Decoders depend only on column types (and vectorFormat), so a cursor builds them on its first batch
+  if (wrapper->decoders.size() != static_cast<size_t>(column_count)) {
+    bool has_field_info = wrapper->field_info.size() == static_cast<size_t>(column_count);
+    wrapper->decoders.resize(column_count);
+    for (int32_t j = 0; j < column_count; j++) {
+      wrapper->decoders[j] = SelectCellDecoder(has_field_info ? wrapper->field_info[j] : nullptr, options);
+    }
+  }
+  if (wrapper->field_info.size() == static_cast<size_t>(column_count)) {
+    for (int32_t j = 0; j < column_count; j++) {
+      out->columns[j].numeric_type = wrapper->field_info[j] && IsNumericFieldType(wrapper->field_info[j]->type);
+    }
+  }
+  const SeekdbCellDecoder* decoders = wrapper->decoders.data();
+  SeekdbColumnBuffer* columns = out->columns.data();
+  std::vector<float> vector_scratch;
+  for (int64_t i = 0; i < remaining_rows; i++) {
+    SeekdbRow row = seekdb_fetch_row(wrapper->result);
+    if (!row) {
+      wrapper->current_row = wrapper->row_count - 1;  // Exhausted early
+      break;
+    }
+    wrapper->current_row++;
+    for (int32_t j = 0; j < column_count; j++) {
+      if (seekdb_row_is_null(row, j)) {
+        DecodeReportedNullCell(row, j, columns[j], scratch);
+      } else {
+        decoders[j](row, j, columns[j], scratch, vector_scratch);
+      }
+    }
+    out->row_count++;
+    if (options.max_result_bytes > 0 && DecodedBytes(*out) > options.max_result_bytes) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static std::string ResultLimitError(const ExecuteOptions& options) {
+  return "Result exceeds maxResultBytes (" + std::to_string(options.max_result_bytes) +
+         "); add a LIMIT, use execute_stream() or onLimit: \"cursor\"";
+}
+
+// LazyCell: { byteLength, read(maxBytes?) } holding only its own payload. read() decodes the cell
+// on each call; maxBytes cuts a string at the last UTF-8 character boundary within that many bytes.
+static Napi::Value LazyCellToValue(Napi::Env env, std::shared_ptr<const std::string> payload, bool float32) {
+  auto cell = Napi::Object::New(env);
+  cell.Set("byteLength", Napi::Number::New(env, static_cast<double>(payload->size())));
+  cell.Set("read", Napi::Function::New(env, [payload, float32](const Napi::CallbackInfo& info) -> Napi::Value {
+    Napi::Env env = info.Env();
+    if (float32) {
+      auto vector = Napi::Float32Array::New(env, payload->size() / sizeof(float));
+      if (!payload->empty()) {
+        memcpy(vector.Data(), payload->data(), vector.ElementLength() * sizeof(float));
+      }
+      return vector;
+    }
+    size_t len = payload->size();
+    if (info.Length() > 0 && info[0].IsNumber()) {
+      len = std::min(len, static_cast<size_t>(std::max<int64_t>(0, info[0].As<Napi::Number>().Int64Value())));
+      while (len > 0 && len < payload->size() && (static_cast<unsigned char>((*payload)[len]) & 0xC0) == 0x80) {
+        len--;
+      }
+    }
+    return Napi::String::New(env, payload->data(), len);
+  }, "read"));
+  return cell;
+}
+
+// Wrap one decoded cell into a JS value. Main thread only.
+static Napi::Value CellToValue(Napi::Env env, const SeekdbColumnBuffer& column, size_t i) {
+  switch (column.kinds[i]) {
+    case CellKind::Bool:
+      return Napi::Boolean::New(env, column.numbers[i] != 0);
+    case CellKind::Number:
+      return Napi::Number::New(env, column.numbers[i]);
+    case CellKind::String:
+      return Napi::String::New(env, column.bytes.data() + column.offsets[i],
+                               column.offsets[i + 1] - column.offsets[i]);
+    case CellKind::Float32Vector: {
+      const size_t byte_len = column.offsets[i + 1] - column.offsets[i];
+      auto vector = Napi::Float32Array::New(env, byte_len / sizeof(float));
+      if (byte_len > 0) {
+        memcpy(vector.Data(), column.bytes.data() + column.offsets[i], byte_len);
+      }
+      return vector;
+    }
+    case CellKind::LazyString:
+    case CellKind::LazyFloat32Vector:
+      return LazyCellToValue(env, column.lazy[static_cast<size_t>(column.numbers[i])],
+                             column.kinds[i] == CellKind::LazyFloat32Vector);
+    case CellKind::Null:
+    default:
+      return env.Null();
+  }
+}
+
+// Build the rowMode "columnar" data object: { column: values } with one entry per column (a later
+// duplicate column name wins). Integer/double columns become one Float64Array filled by a single
+// copy of the worker-decoded numbers (null cells are NaN, TINY booleans are 0/1); other columns,
+// and numeric columns holding text cells, are plain arrays of cell values. Main thread only.
+template <typename CellValue>
+static Napi::Object ColumnarResultData(Napi::Env env, const SeekdbResultBuffer& buffer, size_t row_count,
+                                       const CellValue& cell_value) {
+  auto data = Napi::Object::New(env);
+  for (size_t j = 0; j < buffer.columns.size() && j < buffer.column_names.size(); j++) {
+    const SeekdbColumnBuffer& column = buffer.columns[j];
+    if (column.numeric_type && !column.has_text) {
+      auto values = Napi::Float64Array::New(env, row_count);
+      if (row_count > 0) {
+        memcpy(values.Data(), column.numbers.data(), row_count * sizeof(double));
+      }
+      data.Set(buffer.column_names[j], values);
+      continue;
+    }
+    auto values = Napi::Array::New(env, row_count);
+    for (size_t i = 0; i < row_count; i++) {
+      values.Set(i, cell_value(j, i));
+    }
+    data.Set(buffer.column_names[j], values);
+  }
+  return data;
+}
+
+// Build { columns, rows } from a decoded result. Main thread only.
+// rowMode "object": column-name keys are created once per result and each row object is
+// populated by a single napi_define_properties() call from a reused descriptor template.
+// rowMode "columnar": builds { columns, data } instead, see ColumnarResultData().
+// jsonColumns cells are JSON.parse'd here, so callers need no second pass over the rows.
+// With fields: true, result.fields describes each column, so callers map types once per column.
+// Throws Napi::Error if a jsonColumns cell is not valid JSON.
+static Napi::Object ResultBufferToObject(Napi::Env env, const SeekdbResultBuffer& buffer,
+                                         const ExecuteOptions& options) {
+  auto result_obj = Napi::Object::New(env);
+  if (options.fields) {
+    auto fields = Napi::Array::New(env, buffer.fields.size());
+    for (size_t j = 0; j < buffer.fields.size(); j++) {
+      const SeekdbFieldMeta& meta = buffer.fields[j];
+      auto field = Napi::Object::New(env);
+      field.Set("name", j < buffer.column_names.size() ? buffer.column_names[j] : "");
+      field.Set("type", meta.type < 0 ? env.Null() : Napi::Number::New(env, meta.type));
+      field.Set("length", Napi::Number::New(env, static_cast<double>(meta.length)));
+      field.Set("flags", Napi::Number::New(env, meta.flags));
+      fields.Set(j, field);
+    }
+    result_obj.Set("fields", fields);
+  }
+
+  auto columns = Napi::Array::New(env, buffer.column_names.size());
+  std::vector<napi_property_descriptor> row_template(buffer.column_names.size());
+  for (size_t i = 0; i < buffer.column_names.size(); i++) {
+    auto name = Napi::String::New(env, buffer.column_names[i]);
+    columns.Set(i, name);
+    row_template[i] = napi_property_descriptor{};
+    row_template[i].name = name;
+    row_template[i].attributes = napi_default_jsproperty;
+  }
+  result_obj.Set("columns", columns);
+
+  const size_t column_count = buffer.columns.size();
+  const size_t row_count = column_count > 0 ? static_cast<size_t>(buffer.row_count) : 0;
+
+  // Columns whose string cells are JSON.parse'd
+  std::vector<bool> parse_json(column_count, false);
+  Napi::Function json_parse;
+  if (!options.json_columns.empty()) {
+    for (size_t j = 0; j < column_count && j < buffer.column_names.size(); j++) {
+      parse_json[j] = std::find(options.json_columns.begin(), options.json_columns.end(),
+                                buffer.column_names[j]) != options.json_columns.end();
+    }
+    json_parse = env.Global().Get("JSON").As<Napi::Object>().Get("parse").As<Napi::Function>();
+  }
+  auto cell_value = [&](size_t j, size_t i) -> Napi::Value {
+    Napi::Value value = CellToValue(env, buffer.columns[j], i);
+    if (parse_json[j] && buffer.columns[j].kinds[i] == CellKind::String) {
+      return json_parse.Call({value});
+    }
+    return value;
+  };
+
+  if (options.columnar) {
+    result_obj.Set("data", ColumnarResultData(env, buffer, row_count, cell_value));
+    return result_obj;
+  }
+
+  auto rows = Napi::Array::New(env, row_count);
+  for (size_t i = 0; i < row_count; i++) {
+    if (options.rows_as_objects) {
+      auto row_obj = Napi::Object::New(env);
+      for (size_t j = 0; j < column_count; j++) {
+        row_template[j].value = cell_value(j, i);
+      }
+      napi_status status = napi_define_properties(env, row_obj, column_count, row_template.data());
+      if (status != napi_ok) {
+        throw Napi::Error::New(env);
+      }
+      rows.Set(i, row_obj);
+      continue;
+    }
+    auto row_obj = Napi::Array::New(env, column_count);
+    for (size_t j = 0; j < column_count; j++) {
+      row_obj.Set(j, cell_value(j, i));
+    }
+    rows.Set(i, row_obj);
+  }
+  result_obj.Set("rows", rows);
+  return result_obj;
+}
+
+// Helper functions to get objects from external
+template<typename T>
+T* GetFromExternal(Napi::Env env, Napi::Value value, const napi_type_tag& type_tag) {
+  if (!value.IsExternal()) {
+    throw Napi::TypeError::New(env, "Expected external object");
+  }
+  auto external = value.As<Napi::External<T>>();
+  if (!external.CheckTypeTag(&type_tag)) {
+    throw Napi::TypeError::New(env, "Invalid type tag");
+  }
+  return external.Data();
+}
+
+SeekdbDatabase* GetDatabaseFromExternal(Napi::Env env, Napi::Value value) {
+  return GetFromExternal<SeekdbDatabase>(env, value, DatabaseTypeTag);
+}
+
+SeekdbConnection* GetConnectionFromExternal(Napi::Env env, Napi::Value value) {
+  return GetFromExternal<SeekdbConnection>(env, value, ConnectionTypeTag);
+}
+
+SeekdbPoolHandle* GetPoolFromExternal(Napi::Env env, Napi::Value value) {
+  return GetFromExternal<SeekdbPoolHandle>(env, value, PoolTypeTag);
+}
+
+SeekdbTransactionHandle* GetTransactionFromExternal(Napi::Env env, Napi::Value value) {
+  return GetFromExternal<SeekdbTransactionHandle>(env, value, TransactionTypeTag);
+}
+
+// Accepts a Connection, Pool or Transaction external
+SeekdbExecuteTarget GetExecuteTargetFromExternal(Napi::Env env, Napi::Value value) {
+  SeekdbExecuteTarget target;
+  if (value.IsExternal() &&
+      value.As<Napi::External<SeekdbTransactionHandle>>().CheckTypeTag(&TransactionTypeTag)) {
+    target.transaction = value.As<Napi::External<SeekdbTransactionHandle>>().Data()->tx;
+    if (target.transaction->finished) {
+      throw Napi::Error::New(env, "Transaction is finished");
+    }
+    target.transaction_use = std::make_shared<SeekdbTransactionUse>(target.transaction);
+    target.conn = target.transaction->conn;
+    target.statements = target.transaction->statements;
+    target.stats = target.transaction->stats;
+  } else if (value.IsExternal() && value.As<Napi::External<SeekdbPoolHandle>>().CheckTypeTag(&PoolTypeTag)) {
+    target.pool = value.As<Napi::External<SeekdbPoolHandle>>().Data()->pool;
+    target.statements = &target.pool->statements;
+    target.stats = &target.pool->stats;
+  } else {
+    target.conn = GetConnectionFromExternal(env, value);
+    target.statements = &target.conn->statements;
+    target.stats = &target.conn->stats;
+  }
+  return target;
+}
+
+SeekdbStatement* GetStatementFromExternal(Napi::Env env, Napi::Value value) {
+  return GetFromExternal<SeekdbStatement>(env, value, StatementTypeTag);
+}
+
+SeekdbResultWrapper* GetResultFromExternal(Napi::Env env, Napi::Value value) {
+  return GetFromExternal<SeekdbResultWrapper>(env, value, ResultTypeTag);
+}
+
+// Create external objects
+template<typename T>
+Napi::External<T> CreateExternal(Napi::Env env, const napi_type_tag& type_tag, T* data) {
+  auto external = Napi::External<T>::New(env, data, [](Napi::Env, T* data) {
+    delete data;
+  });
+  external.TypeTag(&type_tag);
+  return external;
+}
+
+// Parse the optional execute() options object. Main thread only.
+static ExecuteOptions ParseExecuteOptions(Napi::Env env, Napi::Value value) {
+  ExecuteOptions options;
+  if (value.IsUndefined() || value.IsNull()) {
+    return options;
+  }
+  if (!value.IsObject()) {
+    throw Napi::TypeError::New(env, "Expected options to be an object");
+  }
+  auto obj = value.As<Napi::Object>();
+  Napi::Value vector_format = obj.Get("vectorFormat");
+  if (!vector_format.IsUndefined()) {
+    std::string format = vector_format.IsString() ? vector_format.As<Napi::String>().Utf8Value() : "";
+    if (format == "float32") {
+      options.vectors_as_float32 = true;
+    } else if (format != "string") {
+      throw Napi::TypeError::New(env, "vectorFormat must be \"string\" or \"float32\"");
+    }
+  }
+  Napi::Value batch_size = obj.Get("batchSize");
+  if (!batch_size.IsUndefined()) {
+    if (!batch_size.IsNumber() || batch_size.As<Napi::Number>().Int64Value() <= 0) {
+      throw Napi::TypeError::New(env, "batchSize must be a positive number");
+    }
+    options.batch_size = batch_size.As<Napi::Number>().Int64Value();
+  }
+  Napi::Value row_mode = obj.Get("rowMode");
+  if (!row_mode.IsUndefined()) {
+    std::string mode = row_mode.IsString() ? row_mode.As<Napi::String>().Utf8Value() : "";
+    if (mode == "object") {
+      options.rows_as_objects = true;
+    } else if (mode == "columnar") {
+      options.columnar = true;
+    } else if (mode != "array") {
+      throw Napi::TypeError::New(env, "rowMode must be \"array\", \"object\" or \"columnar\"");
+    }
+  }
+  options.timing = obj.Get("timing").ToBoolean().Value();
+  options.fields = obj.Get("fields").ToBoolean().Value();
+  Napi::Value timeout_ms = obj.Get("timeoutMs");
+  if (!timeout_ms.IsUndefined()) {
+    if (!timeout_ms.IsNumber() || timeout_ms.As<Napi::Number>().Int64Value() <= 0) {
+      throw Napi::TypeError::New(env, "timeoutMs must be a positive number");
+    }
+    options.timeout_ms = timeout_ms.As<Napi::Number>().Int64Value();
+  }
+  Napi::Value json_columns = obj.Get("jsonColumns");
+  if (json_columns.IsArray()) {
+    auto names = json_columns.As<Napi::Array>();
+    for (uint32_t i = 0; i < names.Length(); i++) {
+      options.json_columns.push_back(names.Get(i).ToString().Utf8Value());
+    }
+  }
+  Napi::Value max_result_bytes = obj.Get("maxResultBytes");
+  if (!max_result_bytes.IsUndefined()) {
+    if (!max_result_bytes.IsNumber() || max_result_bytes.As<Napi::Number>().Int64Value() <= 0) {
+      throw Napi::TypeError::New(env, "maxResultBytes must be a positive number");
+    }
+    options.max_result_bytes = static_cast<uint64_t>(max_result_bytes.As<Napi::Number>().Int64Value());
+  }
+  Napi::Value on_limit = obj.Get("onLimit");
+  if (!on_limit.IsUndefined()) {
+    std::string mode = on_limit.IsString() ? on_limit.As<Napi::String>().Utf8Value() : "";
+    if (mode == "cursor") {
+      options.cursor_on_limit = true;
+    } else if (mode != "error") {
+      throw Napi::TypeError::New(env, "onLimit must be \"error\" or \"cursor\"");
+    }
+  }
+  Napi::Value lazy_columns = obj.Get("lazyColumns");
+  if (!lazy_columns.IsUndefined()) {
+    if (!lazy_columns.IsNumber() || lazy_columns.As<Napi::Number>().Int64Value() <= 0) {
+      throw Napi::TypeError::New(env, "lazyColumns must be a positive number of bytes");
+    }
+    options.lazy_min_bytes = static_cast<size_t>(lazy_columns.As<Napi::Number>().Int64Value());
+  }
+  return options;
+}
+
+// Defaults of configure()
+#define SEEKDB_DEFAULT_EXECUTOR_THREADS 4
+#define SEEKDB_DEFAULT_EXECUTOR_QUEUE_DEPTH 1024
+
+class SeekdbAsyncWorker;
+
+// Bounded lock-free multi-producer/multi-consumer ring (Vyukov). Every cell carries a sequence
+// number, so producers (the JS threads of all envs) and consumers (executor threads) only
+// contend on one CAS each. Capacity is rounded up to a power of two.
+template <typename T>
+class SeekdbMpmcQueue {
+ public:
+  explicit SeekdbMpmcQueue(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    cells_.reset(new Cell[size]);
+    mask_ = size - 1;
+    for (size_t i = 0; i < size; i++) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // Returns false if the ring is full
+  bool TryPush(T value) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = cells_[pos & mask_];
+      size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.value = value;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Returns false if the ring is empty
+  bool TryPop(T* value) {
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = cells_[pos & mask_];
+      size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          *value = cell.value;
+          cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+  std::unique_ptr<Cell[]> cells_;
+  size_t mask_ = 0;
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+};
+
+// Delivers executor completions back to the JS thread of one env through a ThreadSafeFunction.
+// The function is unref'd while nothing is in flight so it never keeps the process alive.
+class SeekdbCompletionChannel {
+ public:
+  static std::shared_ptr<SeekdbCompletionChannel> Create(Napi::Env env) {
+    auto channel = std::make_shared<SeekdbCompletionChannel>();
+    auto noop = Napi::Function::New(env, [](const Napi::CallbackInfo&) {});
+    // Node finalizes the function at env teardown; completions arriving later are dropped (see Post)
+    channel->tsfn_ = Napi::ThreadSafeFunction::New(env, noop, "seekdb_executor", 0, 1,
+                                                   [channel](Napi::Env) {
+      std::lock_guard<std::mutex> lock(channel->mutex_);
+      channel->closed_ = true;
+    });
+    channel->tsfn_.Unref(env);
+    return channel;
+  }
+
+  // Main thread: a worker was submitted / completed
+  void Begin(napi_env env) {
+    if (in_flight_++ == 0) {
+      tsfn_.Ref(env);
+    }
+  }
+  void End(napi_env env) {
+    if (--in_flight_ == 0) {
+      tsfn_.Unref(env);
+    }
+  }
+
+  // Executor thread: schedule worker->CompleteOnMainThread(). Returns false once the env is gone.
+  bool Post(SeekdbAsyncWorker* worker);
+
+ private:
+  std::mutex mutex_;
+  bool closed_ = false;
+  Napi::ThreadSafeFunction tsfn_;
+  size_t in_flight_ = 0;  // Main thread only
+};
+
+// Process-wide native worker pool for query workers, set up by configure(). Keeps DB work off the
+// libuv threadpool so it neither starves nor is starved by fs/dns/zlib. Threads live for the rest
+// of the process, like the engine itself.
+class SeekdbExecutor {
+ public:
+  static SeekdbExecutor& Instance() {
+    // Never destroyed: detached executor threads may still wait on it at process exit
+    static SeekdbExecutor* executor = new SeekdbExecutor();
+    return *executor;
+  }
+
+  // Start the threads. Repeating the running configuration is a no-op; changing it is an error.
+  bool Configure(uint32_t threads, size_t queue_depth, std::string* error) {
+    std::lock_guard<std::mutex> lock(config_mutex_);
+    if (enabled_.load(std::memory_order_acquire)) {
+      if (threads == threads_ && queue_depth == queue_depth_) {
+        return true;
+      }
+      *error = "seekdb executor is already running with " + std::to_string(threads_) +
+               " threads and queueDepth " + std::to_string(queue_depth_) + " in this process";
+      return false;
+    }
+    if (threads == 0) {
+      return true;  // Keep using the libuv threadpool
+    }
+    queue_.reset(new SeekdbMpmcQueue<SeekdbAsyncWorker*>(queue_depth));
+    threads_ = threads;
+    queue_depth_ = queue_depth;
+    for (uint32_t i = 0; i < threads; i++) {
+      std::thread(&SeekdbExecutor::Run, this).detach();
+    }
+    enabled_.store(true, std::memory_order_release);
+    return true;
+  }
+
+  bool Enabled() const { return enabled_.load(std::memory_order_acquire); }
+
+  // Main thread. Returns false if queueDepth workers are already waiting.
+  bool TrySubmit(SeekdbAsyncWorker* worker) {
+    if (pending_.fetch_add(1) >= static_cast<int64_t>(queue_depth_) || !queue_->TryPush(worker)) {
+      pending_.fetch_sub(1);
+      return false;
+    }
+    if (sleepers_.load() > 0) {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+      wake_.notify_one();
+    }
+    return true;
+  }
+
+  size_t QueueDepth() const { return queue_depth_; }
+
+ private:
+  void Run();
+
+  std::mutex config_mutex_;
+  std::atomic<bool> enabled_{false};
+  uint32_t threads_ = 0;
+  size_t queue_depth_ = 0;
+  std::unique_ptr<SeekdbMpmcQueue<SeekdbAsyncWorker*>> queue_;
+  std::atomic<int64_t> pending_{0};  // Submitted and not yet popped
+  std::atomic<int> sleepers_{0};     // Threads waiting on wake_
+  std::mutex wake_mutex_;
+  std::condition_variable wake_;
+};
+
+// Base of the query workers (execute, execute_batch, bulk_insert, fetch_next). Submit() runs
+// Execute() on the SeekdbExecutor once configure() started it, and on the libuv threadpool
+// otherwise; OnOK()/OnError() run on the JS thread either way.
+class SeekdbAsyncWorker : public Napi::AsyncWorker {
+ public:
+  explicit SeekdbAsyncWorker(const Napi::Env& env) : Napi::AsyncWorker(env) {}
+
+  // Main thread. channel is null when the executor is not enabled.
+  void Submit(std::shared_ptr<SeekdbCompletionChannel> channel) {
+    if (!channel) {
+      Queue();
+      return;
+    }
+    channel_ = std::move(channel);
+    channel_->Begin(Env());
+    if (!SeekdbExecutor::Instance().TrySubmit(this)) {
+      SetError("seekdb executor queue is full (queueDepth " +
+               std::to_string(SeekdbExecutor::Instance().QueueDepth()) + ")");
+      CompleteOnMainThread();
+    }
+  }
+
+  // Executor thread
+  void RunOnExecutor() {
+    try {
+      Execute();
+    } catch (const std::exception& e) {
+      SetError(e.what());
+    }
+    // Post() fails only while the env is torn down; its JS objects are gone, so the worker is leaked
+    channel_->Post(this);
+  }
+
+  // Main thread. Deletes the worker.
+  void CompleteOnMainThread() {
+    std::unique_ptr<SeekdbAsyncWorker> self(this);
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    channel_->End(env);
+    if (error_.empty()) {
+      OnOK();
+    } else {
+      OnError(Napi::Error::New(env, error_));
+    }
+  }
+
+ protected:
+  // Shadows Napi::AsyncWorker::SetError so executor runs see the error too
+  void SetError(const std::string& error) {
+    error_ = error.empty() ? "Unknown error" : error;
+    Napi::AsyncWorker::SetError(error_);
+  }
+
+ private:
+  std::shared_ptr<SeekdbCompletionChannel> channel_;
+  std::string error_;
+};
+
+bool SeekdbCompletionChannel::Post(SeekdbAsyncWorker* worker) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (closed_) {
+    return false;
+  }
+  return tsfn_.NonBlockingCall(worker, [](Napi::Env, Napi::Function, SeekdbAsyncWorker* done) {
+    done->CompleteOnMainThread();
+  }) == napi_ok;
+}
+
+void SeekdbExecutor::Run() {
+  for (;;) {
+    SeekdbAsyncWorker* worker = nullptr;
+    if (!queue_->TryPop(&worker)) {
+      std::unique_lock<std::mutex> lock(wake_mutex_);
+      sleepers_++;
+      wake_.wait(lock, [this] { return pending_.load() > 0; });
+      sleepers_--;
+      continue;
+    }
+    pending_.fetch_sub(1);
+    worker->RunOnExecutor();
+  }
+}
+
+// RAII lease of a pooled connection (no-op for single-connection targets)
+struct PoolLease {
+  std::shared_ptr<SeekdbConnectionPool> pool;
+  SeekdbConnection* conn = nullptr;
+  
+  explicit PoolLease(std::shared_ptr<SeekdbConnectionPool> p) : pool(std::move(p)) {}
+  bool Acquire(std::string* error, const std::function<bool()>& aborted = nullptr) {
+    conn = pool->Acquire(error, aborted);
+    return conn != nullptr;
+  }
+  ~PoolLease() {
+    if (conn) {
+      pool->Release(conn);
+    }
+  }
+};
+
+// Resolve the connection a worker runs on: target.conn, or a connection leased into lease.
+// Worker thread. Returns nullptr and sets *error if no pooled connection could be leased
+// (see SeekdbConnectionPool::Acquire() for aborted).
+static SeekdbConnection* AcquireTargetConnection(const SeekdbExecuteTarget& target, PoolLease& lease,
+                                                 std::string* error,
+                                                 const std::function<bool()>& aborted = nullptr) {
+  if (!target.pool) {
+    if (!target.conn->handle) {
+      *error = "Connection is disconnected";
+      return nullptr;
+    }
+    return target.conn;
+  }
+  return lease.Acquire(error, aborted) ? lease.conn : nullptr;
+}
+
+// One SQL statement with its parameters: params are extracted on the main thread (SetParams),
+// bound and run on a worker thread (Run). Shared by ExecuteWorker and BatchWorker.
+class SeekdbQuery {
+ public:
+  explicit SeekdbQuery(std::shared_ptr<const SeekdbStatementInfo> stmt) : stmt_(std::move(stmt)) {}
+  
+  // Extract parameter values (main thread) before Run() executes on a worker
+  void SetParams(const Napi::Array& params) {
+    Napi::HandleScope scope(params.Env());
+    has_params_ = true;
+    
+    param_count_ = params.Length();
+    if (param_count_ > 0) {
+      param_types_.reserve(param_count_);
+      param_strings_.resize(param_count_);
+      param_numbers_.reserve(param_count_);
+      param_bools_.reserve(param_count_);
+      param_bytes_.resize(param_count_);
+      
+      for (uint32_t i = 0; i < param_count_; i++) {
+        Napi::Value param = params.Get(i);
+        
+        if (param.IsNull() || param.IsUndefined()) {
+          param_types_.push_back(SEEKDB_TYPE_NULL);
+          param_numbers_.push_back(0);
+          param_bools_.push_back(false);
+        } else if (param.IsString()) {
+          param_types_.push_back(SEEKDB_TYPE_STRING);
+          param_strings_[i] = param.As<Napi::String>().Utf8Value();
+          param_numbers_.push_back(0);
+          param_bools_.push_back(false);
+        } else if (param.IsNumber()) {
+          double num_val = param.As<Napi::Number>().DoubleValue();
+          param_numbers_.push_back(num_val);
+          // Check if it's an integer
+          if (num_val == static_cast<int64_t>(num_val)) {
+            param_types_.push_back(SEEKDB_TYPE_LONGLONG);
+          } else {
+            param_types_.push_back(SEEKDB_TYPE_DOUBLE);
+          }
+          param_bools_.push_back(false);
+        } else if (param.IsBoolean()) {
+          param_types_.push_back(SEEKDB_TYPE_TINY);
+          param_bools_.push_back(param.As<Napi::Boolean>().Value());
+          param_numbers_.push_back(0);
+        } else if (param.IsTypedArray() &&
+                   param.As<Napi::TypedArray>().TypedArrayType() == napi_float32_array) {
+          // VECTOR param: copy the floats once; the text literal is built on the worker thread
+          auto vector = param.As<Napi::Float32Array>();
+          param_vectors_.emplace_back(vector.Data(), vector.Data() + vector.ElementLength());
+          param_vector_indices_.push_back(i);
+          param_types_.push_back(SEEKDB_TYPE_STRING);
+          param_numbers_.push_back(0);
+          param_bools_.push_back(false);
+        } else if ((param.IsTypedArray() &&
+                    param.As<Napi::TypedArray>().TypedArrayType() == napi_uint8_array) ||
+                   param.IsArrayBuffer()) {
+          // Buffer / Uint8Array / ArrayBuffer: bound in place as BLOB. The object is pinned until
+          // the query is destroyed (main thread); its bytes must not change while it is in flight.
+          if (param.IsArrayBuffer()) {
+            auto buffer = param.As<Napi::ArrayBuffer>();
+            param_bytes_[i] = {static_cast<const char*>(buffer.Data()), buffer.ByteLength()};
+          } else {
+            auto bytes = param.As<Napi::Uint8Array>();
+            param_bytes_[i] = {reinterpret_cast<const char*>(bytes.Data()), bytes.ByteLength()};
+          }
+          pinned_params_.push_back(Napi::Persistent(param.As<Napi::Object>()));
+          param_types_.push_back(SEEKDB_TYPE_BLOB);
+          param_numbers_.push_back(0);
+          param_bools_.push_back(false);
+        } else {
+          // Convert to string
+          param_types_.push_back(SEEKDB_TYPE_STRING);
+          param_strings_[i] = param.ToString().Utf8Value();
+          param_numbers_.push_back(0);
+          param_bools_.push_back(false);
+        }
+      }
+    }
+  }
+  
+  // Bind parameters and run on conn. Worker thread. On success *result is the result set, or
+  // nullptr for statements without one (DML). On failure returns false and sets *error.
+  bool Run(SeekdbConnection* conn, SeekdbResult* result, std::string* error) {
+    SeekdbResult seekdb_result = nullptr;
+    int ret;
+    *result = nullptr;
+
+    if (has_params_ && param_count_ > 0) {
+      // Float32Array params are bound as VECTOR text literals
+      for (size_t k = 0; k < param_vector_indices_.size(); k++) {
+        FormatVectorText(param_vectors_[k].data(), param_vectors_[k].size(),
+                         &param_strings_[param_vector_indices_[k]]);
+      }
+
+      // Which parameters are _id (CAST(? AS BINARY)) - C ABI uses SEEKDB_TYPE_VARBINARY_ID for 512-byte padding
+      const std::vector<bool>& varbinary_id_flags = stmt_->varbinary_id_flags;
+
+      // One slot per param, sized up front so the pointers in binds_ stay valid. String and
+      // BLOB params point straight at param_strings_ / the pinned JS bytes: no copies.
+      binds_.assign(param_count_, SeekdbBind());
+      lengths_.assign(param_count_, 0);
+      null_flags_.assign(param_count_, 0);
+      int_values_.assign(param_count_, 0);
+      double_values_.assign(param_count_, 0);
+      bool_values_.assign(param_count_, 0);
+      
+      for (uint32_t i = 0; i < param_count_; i++) {
+        SeekdbBind& bind = binds_[i];
+        SeekdbFieldType param_type = param_types_[i];
+        bind.is_null = reinterpret_cast<bool*>(&null_flags_[i]);
+        if (param_type == SEEKDB_TYPE_NULL) {
+          null_flags_[i] = 1;
+          bind.buffer_type = SEEKDB_TYPE_NULL;
+        } else if (param_type == SEEKDB_TYPE_STRING || param_type == SEEKDB_TYPE_BLOB) {
+          const char* data;
+          if (param_type == SEEKDB_TYPE_STRING) {
+            data = param_strings_[i].data();
+            lengths_[i] = param_strings_[i].size();
+          } else {
+            data = param_bytes_[i].first ? param_bytes_[i].first : "";
+            lengths_[i] = param_bytes_[i].second;
+          }
+          // _id placeholders (CAST(? AS BINARY)) use VARBINARY_ID so C ABI right-pads to 512 bytes
+          bind.buffer_type = (i < varbinary_id_flags.size() && varbinary_id_flags[i])
+              ? SEEKDB_TYPE_VARBINARY_ID
+              : param_type;
+          bind.buffer = const_cast<char*>(data);
+          bind.buffer_length = lengths_[i];
+          bind.length = &lengths_[i];
+        } else if (param_type == SEEKDB_TYPE_LONGLONG) {
+          int_values_[i] = static_cast<int64_t>(param_numbers_[i]);
+          bind.buffer_type = SEEKDB_TYPE_LONGLONG;
+          bind.buffer = &int_values_[i];
+          bind.buffer_length = sizeof(int64_t);
+        } else if (param_type == SEEKDB_TYPE_DOUBLE) {
+          double_values_[i] = param_numbers_[i];
+          bind.buffer_type = SEEKDB_TYPE_DOUBLE;
+          bind.buffer = &double_values_[i];
+          bind.buffer_length = sizeof(double);
+        } else if (param_type == SEEKDB_TYPE_TINY) {
+          bool_values_[i] = param_bools_[i] ? 1 : 0;
+          bind.buffer_type = SEEKDB_TYPE_TINY;
+          bind.buffer = &bool_values_[i];
+          bind.buffer_length = sizeof(uint8_t);
+        }
+      }
+
+      // Use parameterized query API (C ABI layer handles parameter binding)
+      // Note: The underlying library will auto-detect VECTOR type based on column schema
+      // by preparing the statement first and checking column types
+      
+      ret = seekdb_query_with_params(
+        conn->handle,
+        stmt_->sql.c_str(),
+        &seekdb_result,
+        binds_.data(),
+        static_cast<unsigned int>(binds_.size())
+      );
+      // Fallback: if seekdb_query_with_params returned success but *result null, try seekdb_store_result(handle).
+      if (ret == SEEKDB_SUCCESS && !seekdb_result && stmt_->is_vector_query) {
+        SeekdbResult stored_result = seekdb_store_result(conn->handle);
+        if (stored_result) {
+          seekdb_result = stored_result;
+        }
+      }
+    } else {
+      ret = seekdb_query(conn->handle, stmt_->sql.c_str(), &seekdb_result);
+    }
+    
+    if (ret != SEEKDB_SUCCESS) {
+      // Use connection-specific error first, fallback to thread-local error
+      const char* error_msg = seekdb_error(conn->handle);
+      if (!error_msg) {
+        error_msg = seekdb_last_error();
+      }
+      *error = error_msg ? error_msg : "Query failed";
+      return false;
+    }
+    
+    // If query succeeded but result is null, try to get stored result
+    // Note: For DML statements (INSERT/UPDATE/DELETE), result may be null but query succeeded
+    // This is normal for DML statements, we should create an empty result set
+    if (!seekdb_result) {
+      seekdb_result = seekdb_store_result(conn->handle);
+    }
+    *result = seekdb_result;
+    return true;
+  }
+  
+ private:
+  std::shared_ptr<const SeekdbStatementInfo> stmt_;  // Analyzed SQL (shared with the statement cache)
+  bool has_params_ = false;
+  
+  // Pre-extracted parameter values (extracted in SetParams() on main thread)
+  uint32_t param_count_ = 0;
+  std::vector<SeekdbFieldType> param_types_;
+  std::vector<std::string> param_strings_;         // By param index; STRING params only
+  std::vector<double> param_numbers_;
+  std::vector<bool> param_bools_;
+  std::vector<std::vector<float>> param_vectors_;  // Float32Array params
+  std::vector<uint32_t> param_vector_indices_;     // Param index of each param_vectors_ entry
+  std::vector<std::pair<const char*, size_t>> param_bytes_;  // By param index; BLOB params only
+  std::vector<Napi::ObjectReference> pinned_params_;         // Keeps BLOB params' memory alive
+  
+  // Buffer storage for parameter binding (kept alive during execution), one slot per param
+  std::vector<SeekdbBind> binds_;
+  std::vector<unsigned long> lengths_;
+  std::vector<uint8_t> null_flags_;  // Use uint8_t instead of bool (std::vector<bool> is specialized and can't take address)
+  std::vector<int64_t> int_values_;
+  std::vector<double> double_values_;
+  std::vector<uint8_t> bool_values_;  // Use uint8_t instead of bool (std::vector<bool> is specialized and can't take address)
+};
+
+// Run a statement without parameters, discarding any result. Worker thread.
+static bool RunSimpleQuery(SeekdbConnection* conn, const char* sql, std::string* error) {
+  SeekdbResult result = nullptr;
+  if (seekdb_query(conn->handle, sql, &result) != SEEKDB_SUCCESS) {
+    const char* error_msg = seekdb_error(conn->handle);
+    if (!error_msg) {
+      error_msg = seekdb_last_error();
+    }
+    *error = error_msg ? error_msg : "Query failed";
+    return false;
+  }
+  if (result) {
+    seekdb_result_free(result);
+  }
+  return true;
+}
+
+// Run a single-value query (e.g. SELECT CONNECTION_ID()) and read its first cell. Worker thread.
+static bool QueryInt64(SeekdbConnection* conn, const char* sql, int64_t* value, std::string* error) {
+  SeekdbResult result = nullptr;
+  if (seekdb_query(conn->handle, sql, &result) != SEEKDB_SUCCESS) {
+    const char* error_msg = seekdb_error(conn->handle);
+    if (!error_msg) {
+      error_msg = seekdb_last_error();
+    }
+    *error = error_msg ? error_msg : "Query failed";
+    return false;
+  }
+  if (!result) {
+    result = seekdb_store_result(conn->handle);
+  }
+  SeekdbRow row = result ? seekdb_fetch_row(result) : nullptr;
+  bool ok = row && seekdb_row_get_int64(row, 0, value) == SEEKDB_SUCCESS;
+  if (result) {
+    seekdb_result_free(result);
+  }
+  if (!ok) {
+    *error = std::string("No value returned by ") + sql;
+  }
+  return ok;
+}
+
+// Apply a query's timeoutMs to conn's ob_query_timeout, or (timeout_ms 0) restore the session
+// default. timeoutMs is only accepted on connections the worker has to itself (see QueueExecute)
+// and ExecuteWorker restores the default right after its statement, so later workers on the
+// connection run under the default. Only issues SET when the value changes. Worker thread.
+static bool ApplyQueryTimeout(SeekdbConnection* conn, int64_t timeout_ms, std::string* error) {
+  const int64_t timeout_us = timeout_ms * 1000;
+  if (timeout_us == conn->query_timeout_us) {
+    return true;
+  }
+  int64_t default_us = conn->default_query_timeout_us.load();
+  if (default_us < 0) {
+    if (!QueryInt64(conn, "SELECT @@ob_query_timeout", &default_us, error)) {
+      return false;
+    }
+    conn->default_query_timeout_us = default_us;
+  }
+  const int64_t value = timeout_us > 0 ? timeout_us : default_us;
+  std::string sql = "SET ob_query_timeout = " + std::to_string(value);
+  if (!RunSimpleQuery(conn, sql.c_str(), error)) {
+    return false;
+  }
+  conn->query_timeout_us = timeout_us;
+  return true;
+}
+
+// Cancellation state shared by an ExecuteWorker and its AbortSignal listener.
+// The worker publishes the session it runs on; abort() kills that session's query, or stops
+// the worker before it starts if it is still queued or waiting for a pooled connection.
+struct SeekdbCancelState {
+  std::mutex mutex;
+  bool aborted = false;
+  bool running = false;
+  int64_t session_id = -1;
+  std::string db_name;
+  std::weak_ptr<SeekdbConnectionPool> pool;  // Pool target: interrupted so a waiting lease stops
+};
+
+// Runs KILL QUERY on a separate connection so an aborted statement stops and its worker comes
+// back. Runs on its own detached thread: the thread pools may be saturated by the very queries
+// being aborted. signal is only accepted on connections the worker has to itself (see
+// QueueExecute), and the KILL is issued under cancel->mutex and only while cancel->running, which
+// the worker clears under the same lock when its statement returns, so it can never hit another
+// statement of the session. Best effort: errors are ignored, the aborted query
+// still rejects with AbortError when its worker finishes.
+static void KillQueryAsync(std::shared_ptr<SeekdbCancelState> cancel) {
+  std::thread([cancel] {
+    std::string db_name;
+    {
+      std::lock_guard<std::mutex> lock(cancel->mutex);
+      if (!cancel->running) {
+        return;
+      }
+      db_name = cancel->db_name;
+    }
+    if (!SeekdbEngineRegistry::Retain()) {
+      return;
+    }
+    SeekdbHandle handle = nullptr;
+    if (seekdb_connect(&handle, db_name.c_str(), true) == SEEKDB_SUCCESS && handle) {
+      std::lock_guard<std::mutex> lock(cancel->mutex);
+      if (cancel->running && cancel->session_id >= 0) {
+        std::string sql = "KILL QUERY " + std::to_string(cancel->session_id);
+        SeekdbResult result = nullptr;
+        if (seekdb_query(handle, sql.c_str(), &result) == SEEKDB_SUCCESS && result) {
+          seekdb_result_free(result);
+        }
+      }
+    }
+    if (handle) {
+      seekdb_connect_close(handle);
+    }
+    SeekdbEngineRegistry::Release();
+  }).detach();
+}
+
+// Reject value of an aborted query
+static Napi::Value CreateAbortError(Napi::Env env) {
+  auto error = Napi::Error::New(env, "Query aborted");
+  error.Set("name", Napi::String::New(env, "AbortError"));
+  return error.Value();
+}
+
+// Async worker for execute operation
+class ExecuteWorker : public SeekdbAsyncWorker {
+ public:
+  ExecuteWorker(Napi::Promise::Deferred deferred, SeekdbExecuteTarget target,
+                std::shared_ptr<const SeekdbStatementInfo> stmt, const ExecuteOptions& options)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred), target_(std::move(target)),
+      query_(std::move(stmt)), options_(options), has_result_(false) {
+    timing_.enqueued = SeekdbQueryTiming::Clock::now();
+  }
+  
+  ExecuteWorker(Napi::Promise::Deferred deferred, SeekdbExecuteTarget target,
+                std::shared_ptr<const SeekdbStatementInfo> stmt, const Napi::Array& params,
+                const ExecuteOptions& options)
+    : ExecuteWorker(deferred, std::move(target), std::move(stmt), options) {
     // Extract parameter values in constructor (main thread) before Execute() runs
-    // This is safe because constructor runs on main thread
-    Napi::Env env = deferred.Env();
+    query_.SetParams(params);
+  }
+
+ protected:
+  void Execute() override {
+    // Pool targets lease a connection for the whole Execute(); it returns to the pool on every exit path.
+    // An abort while waiting for a pooled connection stops the wait.
+    PoolLease lease(target_.pool);
+    std::string error;
+    std::function<bool()> aborted;
+    if (cancel_) {
+      aborted = [this] {
+        std::lock_guard<std::mutex> lock(cancel_->mutex);
+        return cancel_->aborted;
+      };
+    }
+    SeekdbConnection* conn = AcquireTargetConnection(target_, lease, &error, aborted);
+    if (!conn) {
+      SetError(error);
+      return;
+    }
+    if (!ApplyQueryTimeout(conn, options_.timeout_ms, &error)) {
+      SetError("Failed to set timeoutMs: " + error);
+      return;
+    }
+    if (cancel_ && !BeginCancellable(conn, &error)) {
+      SetError(error);
+      return;
+    }
+    
+    timing_.started = SeekdbQueryTiming::Clock::now();
+    SeekdbResult seekdb_result = nullptr;
+    bool ok = query_.Run(conn, &seekdb_result, &error);
+    timing_.engine_done = timing_.decoded = SeekdbQueryTiming::Clock::now();
+    if (cancel_) {
+      std::lock_guard<std::mutex> lock(cancel_->mutex);
+      cancel_->running = false;
+    }
+    if (options_.timeout_ms > 0) {
+      // Best effort: if this fails, the next ExecuteWorker on conn retries it before its statement
+      std::string restore_error;
+      ApplyQueryTimeout(conn, 0, &restore_error);
+    }
+    if (!ok) {
+      SetError(error);
+      return;
+    }
+    if (options_.stream) {
+      // execute_stream(): hand the open result to JS as a cursor (empty cursor for DML)
+      try {
+        cursor_.reset(new SeekdbResultWrapper(seekdb_result));
+        cursor_->options = options_;
+      } catch (const std::bad_alloc& e) {
+        if (!cursor_ && seekdb_result) {
+          seekdb_result_free(seekdb_result);
+        }
+        SetError("Memory allocation failed: " + std::string(e.what()));
+      }
+      return;
+    }
+    if (!seekdb_result) {
+      has_result_ = false;
+      return;
+    }
+    try {
+      // Decode all rows here so OnOK() only wraps native buffers into JS values.
+      // The C ABI result is released as soon as it is decoded.
+      // Past maxResultBytes with onLimit "cursor", the rest stays open for fetch_next()
+      std::unique_ptr<SeekdbResultWrapper> wrapper(new SeekdbResultWrapper(seekdb_result));
+      if (DecodeResult(wrapper.get(), &decoded_, scratch_, options_)) {
+        if (!options_.cursor_on_limit) {
+          SetError(ResultLimitError(options_));
+          return;
+        }
+        if (wrapper->current_row + 1 < wrapper->row_count) {
+          wrapper->options = options_;
+          cursor_ = std::move(wrapper);
+        }
+      }
+      has_result_ = true;
+    } catch (const std::bad_alloc& e) {
+      SetError("Memory allocation failed: " + std::string(e.what()));
+      return;
+    } catch (const std::exception& e) {
+      SetError("Exception in Execute: " + std::string(e.what()));
+      return;
+    }
+    timing_.decoded = SeekdbQueryTiming::Clock::now();
+    timing_.rows = static_cast<uint64_t>(decoded_.row_count);
+    for (const auto& column : decoded_.columns) {
+      timing_.bytes += column.bytes.size() + column.lazy_bytes;
+    }
+    timing_.fallback_reads = scratch_.fallback_reads;
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
     Napi::HandleScope scope(env);
     
-    param_count_ = params.Length();
-    if (param_count_ > 0) {
-      param_types_.reserve(param_count_);
-      param_strings_.reserve(param_count_);
-      param_numbers_.reserve(param_count_);
-      param_bools_.reserve(param_count_);
-      
-      for (uint32_t i = 0; i < param_count_; i++) {
-        Napi::Value param = params.Get(i);
-        
-        if (param.IsNull() || param.IsUndefined()) {
-          param_types_.push_back(SEEKDB_TYPE_NULL);
-          param_strings_.push_back("");
-          param_numbers_.push_back(0);
-          param_bools_.push_back(false);
-        } else if (param.IsString()) {
-          param_types_.push_back(SEEKDB_TYPE_STRING);
-          param_strings_.push_back(param.As<Napi::String>().Utf8Value());
-          param_numbers_.push_back(0);
-          param_bools_.push_back(false);
-        } else if (param.IsNumber()) {
-          double num_val = param.As<Napi::Number>().DoubleValue();
-          param_numbers_.push_back(num_val);
-          // Check if it's an integer
-          if (num_val == static_cast<int64_t>(num_val)) {
-            param_types_.push_back(SEEKDB_TYPE_LONGLONG);
-          } else {
-            param_types_.push_back(SEEKDB_TYPE_DOUBLE);
+    if (DisarmSignal()) {
+      RecordError();
+      deferred_.Reject(CreateAbortError(env));
+      return;
+    }
+    if (options_.stream) {
+      RecordStats(SeekdbQueryTiming::Clock::now());
+      deferred_.Resolve(CreateExternal<SeekdbResultWrapper>(env, ResultTypeTag, cursor_.release()));
+      return;
+    }
+    
+    // Handle queries with null result (empty result set)
+    // This can happen for:
+    // 1. DML statements (INSERT/UPDATE/DELETE) - normal, return empty result
+    // 2. SELECT queries with no matching rows - also normal, return empty result with columns
+    // Reference implementation creates empty result set in both cases
+    Napi::Object result_obj;
+    try {
+      result_obj = ResultBufferToObject(env, has_result_ ? decoded_ : SeekdbResultBuffer(), options_);
+    } catch (const Napi::Error& e) {
+      RecordError();
+      deferred_.Reject(e.Value());
+      return;
+    }
+    auto materialized = SeekdbQueryTiming::Clock::now();
+    RecordStats(materialized);
+    if (options_.timing) {
+      result_obj.Set("timing", TimingToObject(env, materialized));
+    }
+    if (cursor_) {
+      result_obj.Set("cursor", CreateExternal<SeekdbResultWrapper>(env, ResultTypeTag, cursor_.release()));
+    }
+    deferred_.Resolve(result_obj);
+  }
+
+  void OnError(const Napi::Error& e) override {
+    RecordError();
+    if (DisarmSignal()) {
+      deferred_.Reject(CreateAbortError(Env()));
+      return;
+    }
+    deferred_.Reject(e.Value());
+  }
+
+ public:
+  // Listen for abort on signal (an AbortSignal). Main thread, before Queue().
+  void ArmSignal(Napi::Object signal) {
+    Napi::Env env = signal.Env();
+    cancel_ = std::make_shared<SeekdbCancelState>();
+    cancel_->pool = target_.pool;
+    std::shared_ptr<SeekdbCancelState> cancel = cancel_;
+    auto on_abort = Napi::Function::New(env, [cancel](const Napi::CallbackInfo&) {
+      bool running;
+      {
+        std::lock_guard<std::mutex> lock(cancel->mutex);
+        if (cancel->aborted) {
+          return;
+        }
+        cancel->aborted = true;
+        running = cancel->running;
+      }
+      if (running) {
+        KillQueryAsync(cancel);
+      } else if (auto pool = cancel->pool.lock()) {
+        pool->Interrupt();
+      }
+    });
+    signal.Get("addEventListener").As<Napi::Function>().Call(signal, {Napi::String::New(env, "abort"), on_abort});
+    signal_ = Napi::Persistent(signal);
+    on_abort_ = Napi::Persistent(on_abort);
+  }
+
+ private:
+  // Publish the session this query runs on, unless already aborted. Worker thread.
+  bool BeginCancellable(SeekdbConnection* conn, std::string* error) {
+    int64_t session_id = conn->session_id.load();
+    if (session_id < 0) {
+      if (!QueryInt64(conn, "SELECT CONNECTION_ID()", &session_id, error)) {
+        return false;
+      }
+      conn->session_id = session_id;
+    }
+    std::lock_guard<std::mutex> lock(cancel_->mutex);
+    if (cancel_->aborted) {
+      *error = "Query aborted";
+      return false;
+    }
+    cancel_->running = true;
+    cancel_->session_id = session_id;
+    cancel_->db_name = conn->db_name;
+    return true;
+  }
+
+  // Add this query to the target's stats(). Main thread.
+  void RecordStats(SeekdbQueryTiming::Clock::time_point materialized) {
+    SeekdbQueryStats& stats = *target_.stats;
+    stats.queries++;
+    stats.rows += timing_.rows;
+    stats.bytes += timing_.bytes;
+    stats.fallback_reads += timing_.fallback_reads;
+    stats.queue.Record(SeekdbQueryTiming::Ms(timing_.enqueued, timing_.started));
+    stats.engine.Record(SeekdbQueryTiming::Ms(timing_.started, timing_.engine_done));
+    stats.fetch.Record(SeekdbQueryTiming::Ms(timing_.engine_done, timing_.decoded));
+    stats.materialize.Record(SeekdbQueryTiming::Ms(timing_.decoded, materialized));
+    stats.total.Record(SeekdbQueryTiming::Ms(timing_.enqueued, materialized));
+  }
+
+  void RecordError() {
+    target_.stats->errors++;
+  }
+
+  // The QueryTiming attached to the result with { timing: true }. Main thread.
+  Napi::Object TimingToObject(Napi::Env env, SeekdbQueryTiming::Clock::time_point materialized) const {
+    auto obj = Napi::Object::New(env);
+    obj.Set("queueMs", Napi::Number::New(env, SeekdbQueryTiming::Ms(timing_.enqueued, timing_.started)));
+    obj.Set("engineMs", Napi::Number::New(env, SeekdbQueryTiming::Ms(timing_.started, timing_.engine_done)));
+    obj.Set("fetchMs", Napi::Number::New(env, SeekdbQueryTiming::Ms(timing_.engine_done, timing_.decoded)));
+    obj.Set("materializeMs", Napi::Number::New(env, SeekdbQueryTiming::Ms(timing_.decoded, materialized)));
+    obj.Set("totalMs", Napi::Number::New(env, SeekdbQueryTiming::Ms(timing_.enqueued, materialized)));
+    obj.Set("rows", Napi::Number::New(env, static_cast<double>(timing_.rows)));
+    obj.Set("bytes", Napi::Number::New(env, static_cast<double>(timing_.bytes)));
+    obj.Set("fallbackReads", Napi::Number::New(env, static_cast<double>(timing_.fallback_reads)));
+    return obj;
+  }
+
+  // Remove the abort listener. Returns true if the signal fired. Main thread.
+  bool DisarmSignal() {
+    if (!cancel_) {
+      return false;
+    }
+    Napi::Object signal = signal_.Value();
+    signal.Get("removeEventListener").As<Napi::Function>().Call(
+        signal, {Napi::String::New(Env(), "abort"), on_abort_.Value()});
+    std::lock_guard<std::mutex> lock(cancel_->mutex);
+    return cancel_->aborted;
+  }
+
+  Napi::Promise::Deferred deferred_;
+  SeekdbExecuteTarget target_;
+  SeekdbQuery query_;
+  ExecuteOptions options_;
+  
+  SeekdbQueryTiming timing_;
+  
+  // signal option: shared with the abort listener
+  std::shared_ptr<SeekdbCancelState> cancel_;
+  Napi::ObjectReference signal_;
+  Napi::FunctionReference on_abort_;
+  
+  // Result decoded on the worker thread (valid when has_result_)
+  bool has_result_;
+  SeekdbResultBuffer decoded_;
+  SeekdbScratchBuffer scratch_;
+  
+  // execute_stream(), or the rest of a result past maxResultBytes: open result handed to JS in OnOK()
+  std::unique_ptr<SeekdbResultWrapper> cursor_;
+};
+
+// Async worker for execute_batch: runs all statements sequentially on one connection in a
+// single worker hop, optionally inside BEGIN/COMMIT (ROLLBACK on the first failure)
+class BatchWorker : public SeekdbAsyncWorker {
+ public:
+  BatchWorker(Napi::Promise::Deferred deferred, SeekdbExecuteTarget target, std::vector<SeekdbQuery> queries,
+              const ExecuteOptions& options, bool transactional)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred), target_(std::move(target)),
+      queries_(std::move(queries)), options_(options), transactional_(transactional) {}
+
+ protected:
+  void Execute() override {
+    PoolLease lease(target_.pool);
+    std::string error;
+    SeekdbConnection* conn = AcquireTargetConnection(target_, lease, &error);
+    if (!conn) {
+      SetError(error);
+      return;
+    }
+    
+    if (transactional_ && !RunSimpleQuery(conn, "BEGIN", &error)) {
+      SetError("Failed to begin transaction: " + error);
+      return;
+    }
+    results_.resize(queries_.size());
+    for (size_t i = 0; i < queries_.size(); i++) {
+      SeekdbResult seekdb_result = nullptr;
+      bool ok = queries_[i].Run(conn, &seekdb_result, &error);
+      if (ok && seekdb_result) {
+        try {
+          std::unique_ptr<SeekdbResultWrapper> wrapper(new SeekdbResultWrapper(seekdb_result));
+          if (DecodeResult(wrapper.get(), &results_[i], scratch_, options_)) {
+            ok = false;
+            error = ResultLimitError(options_);
           }
-          param_strings_.push_back("");
-          param_bools_.push_back(false);
-        } else if (param.IsBoolean()) {
-          param_types_.push_back(SEEKDB_TYPE_TINY);
-          param_bools_.push_back(param.As<Napi::Boolean>().Value());
-          param_strings_.push_back("");
-          param_numbers_.push_back(0);
-        } else {
-          // Convert to string
-          param_types_.push_back(SEEKDB_TYPE_STRING);
-          param_strings_.push_back(param.ToString().Utf8Value());
-          param_numbers_.push_back(0);
-          param_bools_.push_back(false);
+        } catch (const std::bad_alloc& e) {
+          ok = false;
+          error = "Memory allocation failed: " + std::string(e.what());
+        }
+      }
+      if (!ok) {
+        if (transactional_) {
+          std::string rollback_error;
+          RunSimpleQuery(conn, "ROLLBACK", &rollback_error);
         }
+        SetError("Statement " + std::to_string(i) + " failed: " + error);
+        return;
       }
     }
+    if (transactional_ && !RunSimpleQuery(conn, "COMMIT", &error)) {
+      std::string rollback_error;
+      RunSimpleQuery(conn, "ROLLBACK", &rollback_error);
+      SetError("Failed to commit transaction: " + error);
+    }
   }
 
-  ~ExecuteWorker() {
-    if (result_) {
-      delete result_;
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    auto results = Napi::Array::New(env, results_.size());
+    try {
+      for (size_t i = 0; i < results_.size(); i++) {
+        results.Set(i, ResultBufferToObject(env, results_[i], options_));
+      }
+    } catch (const Napi::Error& e) {
+      deferred_.Reject(e.Value());
+      return;
     }
+    deferred_.Resolve(results);
+  }
+
+  void OnError(const Napi::Error& e) override {
+    deferred_.Reject(e.Value());
   }
 
+ private:
+  Napi::Promise::Deferred deferred_;
+  SeekdbExecuteTarget target_;
+  std::vector<SeekdbQuery> queries_;
+  ExecuteOptions options_;
+  bool transactional_;
+  std::vector<SeekdbResultBuffer> results_;  // One per statement; empty for DML
+  SeekdbScratchBuffer scratch_;
+};
+
+// warm_pool(): opens pooled connections (running the pool's init statements) ahead of traffic
+class WarmPoolWorker : public SeekdbAsyncWorker {
+ public:
+  WarmPoolWorker(Napi::Promise::Deferred deferred, std::shared_ptr<SeekdbConnectionPool> pool,
+                 uint32_t count)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred), pool_(std::move(pool)), count_(count) {}
+
  protected:
   void Execute() override {
-    SeekdbResult seekdb_result = nullptr;
-    int ret;
+    std::string error;
+    if (!pool_->Fill(count_, &error)) {
+      SetError(error);
+    }
+  }
 
-    if (has_params_ && param_count_ > 0) {
-      // Which parameters are _id (CAST(? AS BINARY)) - C ABI uses SEEKDB_TYPE_VARBINARY_ID for 512-byte padding
-      std::vector<bool> varbinary_id_flags = get_varbinary_id_param_indices(sql_, param_count_);
-
-      // Build SeekdbBind array from pre-extracted parameter values
-      // This is safe because we're only using C++ types, no NAPI objects
-      std::vector<SeekdbBind> binds;
-      std::vector<std::vector<char>> string_buffers;  // Keep string buffers alive
-      std::vector<unsigned long> lengths;
-      // Use uint8_t instead of bool for null_flags (std::vector<bool> is specialized and can't take address)
-      std::vector<uint8_t> null_flags;
-      std::vector<int64_t> int_values;
-      std::vector<double> double_values;
-      // Use uint8_t instead of bool for bool_values (std::vector<bool> is specialized and can't take address)
-      std::vector<uint8_t> bool_values;
-      
-      for (uint32_t i = 0; i < param_count_; i++) {
-        SeekdbBind bind = {};
-        SeekdbFieldType param_type = param_types_[i];
-        if (param_type == SEEKDB_TYPE_NULL) {
-          null_flags.push_back(1);  // true
-          bind.buffer_type = SEEKDB_TYPE_NULL;
-          bind.is_null = reinterpret_cast<bool*>(&null_flags.back());
-        } else if (param_type == SEEKDB_TYPE_STRING) {
-          const std::string& str_val = param_strings_[i];
-          
-          // _id placeholders (CAST(? AS BINARY)) use VARBINARY_ID so C ABI right-pads to 512 bytes
-          SeekdbFieldType bind_type = (i < varbinary_id_flags.size() && varbinary_id_flags[i])
-              ? SEEKDB_TYPE_VARBINARY_ID
-              : SEEKDB_TYPE_STRING;
-          string_buffers.push_back(std::vector<char>(str_val.begin(), str_val.end()));
-          string_buffers.back().push_back('\0');
-          
-          lengths.push_back(str_val.length());
-          null_flags.push_back(0);  // false
-          bind.buffer_type = bind_type;
-          bind.buffer = string_buffers.back().data();
-          bind.buffer_length = str_val.length();
-          bind.length = &lengths.back();
-          bind.is_null = reinterpret_cast<bool*>(&null_flags.back());
-        } else if (param_type == SEEKDB_TYPE_LONGLONG) {
-          int_values.push_back(static_cast<int64_t>(param_numbers_[i]));
-          null_flags.push_back(0);  // false
-          
-          bind.buffer_type = SEEKDB_TYPE_LONGLONG;
-          bind.buffer = &int_values.back();
-          bind.buffer_length = sizeof(int64_t);
-          bind.is_null = reinterpret_cast<bool*>(&null_flags.back());
-        } else if (param_type == SEEKDB_TYPE_DOUBLE) {
-          double_values.push_back(param_numbers_[i]);
-          null_flags.push_back(0);  // false
-          
-          bind.buffer_type = SEEKDB_TYPE_DOUBLE;
-          bind.buffer = &double_values.back();
-          bind.buffer_length = sizeof(double);
-          bind.is_null = reinterpret_cast<bool*>(&null_flags.back());
-        } else if (param_type == SEEKDB_TYPE_TINY) {
-          bool_values.push_back(param_bools_[i] ? 1 : 0);
-          null_flags.push_back(0);  // false
-          
-          bind.buffer_type = SEEKDB_TYPE_TINY;
-          bind.buffer = &bool_values.back();
-          bind.buffer_length = sizeof(uint8_t);
-          bind.is_null = reinterpret_cast<bool*>(&null_flags.back());
-        }
-        
-        binds.push_back(bind);
-      }
-      
-      // IMPORTANT: Store buffers in member variables BEFORE building binds array
-      // This ensures pointers in binds remain valid after move
-      // Store buffers first to keep them alive during execution
-      string_buffers_ = std::move(string_buffers);
-      lengths_ = std::move(lengths);
-      null_flags_ = std::move(null_flags);
-      int_values_ = std::move(int_values);
-      double_values_ = std::move(double_values);
-      bool_values_ = std::move(bool_values);
-      
-      // Now rebuild binds array with pointers to member variables
-      // This is necessary because move() invalidates pointers in the original binds
-      binds.clear();
-      size_t string_idx = 0;
-      size_t length_idx = 0;
-      size_t null_idx = 0;
-      size_t int_idx = 0;
-      size_t double_idx = 0;
-      size_t bool_idx = 0;
-      
-      for (uint32_t i = 0; i < param_count_; i++) {
-        SeekdbBind bind = {};
-        SeekdbFieldType param_type = param_types_[i];
-        SeekdbFieldType bind_type = param_type;
-        if (param_type == SEEKDB_TYPE_STRING && i < varbinary_id_flags.size() && varbinary_id_flags[i]) {
-          bind_type = SEEKDB_TYPE_VARBINARY_ID;
-        }
-        
-        if (param_type == SEEKDB_TYPE_NULL) {
-          bind.buffer_type = SEEKDB_TYPE_NULL;
-          bind.is_null = reinterpret_cast<bool*>(&null_flags_[null_idx++]);
-        } else if (param_type == SEEKDB_TYPE_STRING) {
-          bind.buffer_type = bind_type;
-          bind.buffer = string_buffers_[string_idx].data();
-          bind.buffer_length = string_buffers_[string_idx].size() - 1;  // Exclude null terminator
-          bind.length = &lengths_[length_idx++];
-          bind.is_null = reinterpret_cast<bool*>(&null_flags_[null_idx++]);
-          string_idx++;
-        } else if (param_type == SEEKDB_TYPE_LONGLONG) {
-          bind.buffer_type = SEEKDB_TYPE_LONGLONG;
-          bind.buffer = &int_values_[int_idx++];
-          bind.buffer_length = sizeof(int64_t);
-          bind.is_null = reinterpret_cast<bool*>(&null_flags_[null_idx++]);
-        } else if (param_type == SEEKDB_TYPE_DOUBLE) {
-          bind.buffer_type = SEEKDB_TYPE_DOUBLE;
-          bind.buffer = &double_values_[double_idx++];
-          bind.buffer_length = sizeof(double);
-          bind.is_null = reinterpret_cast<bool*>(&null_flags_[null_idx++]);
-        } else if (param_type == SEEKDB_TYPE_TINY) {
-          bind.buffer_type = SEEKDB_TYPE_TINY;
-          bind.buffer = &bool_values_[bool_idx++];
-          bind.buffer_length = sizeof(uint8_t);
-          bind.is_null = reinterpret_cast<bool*>(&null_flags_[null_idx++]);
-        }
-        
-        binds.push_back(bind);
+  void OnOK() override {
+    deferred_.Resolve(Napi::Number::New(Env(), pool_->Stats().total));
+  }
+
+  void OnError(const Napi::Error& e) override {
+    deferred_.Reject(e.Value());
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  std::shared_ptr<SeekdbConnectionPool> pool_;
+  uint32_t count_;
+};
+
+// begin(): leases the connection a pooled transaction is pinned to, then runs BEGIN on it
+class BeginWorker : public SeekdbAsyncWorker {
+ public:
+  BeginWorker(Napi::Promise::Deferred deferred, std::shared_ptr<SeekdbTransaction> tx)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred), tx_(std::move(tx)) {}
+
+ protected:
+  void Execute() override {
+    std::string error;
+    if (tx_->pool) {
+      tx_->conn = tx_->pool->Acquire(&error);
+      if (!tx_->conn) {
+        SetError(error);
+        return;
       }
-      
-      binds_ = std::move(binds);
+    } else if (!tx_->conn->handle) {
+      SetError("Connection is disconnected");
+      return;
+    }
+    // A failed BEGIN leaves the session untouched, so the connection can be reused
+    if (!RunSimpleQuery(tx_->conn, "BEGIN", &error)) {
+      tx_->clean = true;
+      SetError("Failed to begin transaction: " + error);
+    }
+  }
 
-      // Use parameterized query API (C ABI layer handles parameter binding)
-      // Note: The underlying library will auto-detect VECTOR type based on column schema
-      // by preparing the statement first and checking column types
-      
-      // Check if this is a vector query
-      bool is_vector_query = (sql_.find("cosine_distance") != std::string::npos || 
-                              sql_.find("l2_distance") != std::string::npos ||
-                              sql_.find("inner_product") != std::string::npos);
-      
-      ret = seekdb_query_with_params(
-        conn_->handle,
-        sql_.c_str(),
-        &seekdb_result,
-        binds_.data(),
-        static_cast<unsigned int>(binds_.size())
-      );
-      // Fallback: if seekdb_query_with_params returned success but *result null, try seekdb_store_result(handle).
-      if (ret == SEEKDB_SUCCESS && !seekdb_result && is_vector_query) {
-        SeekdbResult stored_result = seekdb_store_result(conn_->handle);
-        if (stored_result) {
-          seekdb_result = stored_result;
-        }
+  void OnOK() override {
+    Napi::Env env = Env();
+    deferred_.Resolve(CreateExternal<SeekdbTransactionHandle>(env, TransactionTypeTag,
+                                                              new SeekdbTransactionHandle(tx_)));
+  }
+
+  void OnError(const Napi::Error& e) override {
+    deferred_.Reject(e.Value());
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  std::shared_ptr<SeekdbTransaction> tx_;
+};
+
+// commit()/rollback(). A failed COMMIT is rolled back; a pooled connection whose rollback also
+// failed is discarded rather than returned to the pool.
+class EndTransactionWorker : public SeekdbAsyncWorker {
+ public:
+  EndTransactionWorker(Napi::Promise::Deferred deferred, std::shared_ptr<SeekdbTransaction> tx, bool commit)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred), tx_(std::move(tx)), commit_(commit) {}
+
+ protected:
+  void Execute() override {
+    std::string error;
+    if (!tx_->conn->handle) {
+      // disconnect() closed the session, which rolled the transaction back
+      SetError("Connection is disconnected");
+      return;
+    }
+    if (commit_ && RunSimpleQuery(tx_->conn, "COMMIT", &error)) {
+      tx_->clean = true;
+      return;
+    }
+    std::string rollback_error;
+    tx_->clean = RunSimpleQuery(tx_->conn, "ROLLBACK", &rollback_error);
+    if (commit_) {
+      SetError("Failed to commit transaction: " + error);
+    } else if (!tx_->clean) {
+      SetError("Failed to roll back transaction: " + rollback_error);
+    }
+  }
+
+  void OnOK() override {
+    deferred_.Resolve(Env().Undefined());
+  }
+
+  void OnError(const Napi::Error& e) override {
+    deferred_.Reject(e.Value());
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  std::shared_ptr<SeekdbTransaction> tx_;
+  bool commit_;
+};
+
+// Quote a value as a MySQL string literal
+static std::string QuoteStringLiteral(const std::string& value) {
+  std::string quoted = "'";
+  for (char c : value) {
+    if (c == '\'' || c == '\\') {
+      quoted.push_back('\\');
+    }
+    quoted.push_back(c);
+  }
+  quoted.push_back('\'');
+  return quoted;
+}
+
+// Run a single-value query and read its first cell as a string. *found is false when the query
+// returns no row or a NULL/empty cell. Worker thread.
+static bool QueryString(SeekdbConnection* conn, const char* sql, SeekdbScratchBuffer& scratch,
+                        std::string* value, bool* found, std::string* error) {
+  SeekdbResult result = nullptr;
+  *found = false;
+  if (seekdb_query(conn->handle, sql, &result) != SEEKDB_SUCCESS) {
+    const char* error_msg = seekdb_error(conn->handle);
+    if (!error_msg) {
+      error_msg = seekdb_last_error();
+    }
+    *error = error_msg ? error_msg : "Query failed";
+    return false;
+  }
+  if (!result) {
+    result = seekdb_store_result(conn->handle);
+  }
+  SeekdbRow row = result ? seekdb_fetch_row(result) : nullptr;
+  if (row) {
+    // Long TEXT may report length 0 (see DecodeReportedNullCell): read through a 2MB buffer then
+    size_t str_len = seekdb_row_get_string_len(row, 0);
+    size_t buf_size = str_len > 0 ? str_len + 1 : 2 * 1024 * 1024;
+    const char* str = nullptr;
+    size_t len = 0;
+    if (ReadCellString(row, 0, buf_size, scratch, &str, &len) == SEEKDB_SUCCESS && len > 0) {
+      value->assign(str, len);
+      *found = true;
+    }
+  }
+  if (result) {
+    seekdb_result_free(result);
+  }
+  return true;
+}
+
+// Case-insensitive search for word (which starts and ends with word characters) delimited by
+// non-word characters, like the SDK's /\bWORD\b/i
+static bool ContainsWord(const std::string& text, const char* word) {
+  const size_t word_len = strlen(word);
+  auto is_word = [](char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+  };
+  for (size_t pos = 0; pos + word_len <= text.size(); pos++) {
+    if ((pos > 0 && is_word(text[pos - 1])) ||
+        (pos + word_len < text.size() && is_word(text[pos + word_len]))) {
+      continue;
+    }
+    size_t k = 0;
+    while (k < word_len && std::toupper(static_cast<unsigned char>(text[pos + k])) == word[k]) {
+      k++;
+    }
+    if (k == word_len) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Remove the quotes GET_SQL may wrap its result in (the SDK's trim() + /^['"]|['"]$/g)
+static void UnquoteGeneratedSql(std::string* sql) {
+  const char* whitespace = " \t\n\r\f\v";
+  size_t begin = sql->find_first_not_of(whitespace);
+  if (begin == std::string::npos) {
+    sql->clear();
+    return;
+  }
+  size_t end = sql->find_last_not_of(whitespace) + 1;
+  if ((*sql)[begin] == '\'' || (*sql)[begin] == '"') {
+    begin++;
+  }
+  if (end > begin && ((*sql)[end - 1] == '\'' || (*sql)[end - 1] == '"')) {
+    end--;
+  }
+  *sql = sql->substr(begin, end - begin);
+}
+
+// Same checks as the SDK's validateDynamicSql() on SQL returned by DBMS_HYBRID_SEARCH.GET_SQL:
+// a single SELECT without data-changing or file-access keywords (comments are ignored)
+static bool ValidateGeneratedSql(const std::string& sql, std::string* error) {
+  if (sql.empty()) {
+    *error = "Invalid SQL query: must be a non-empty string";
+    return false;
+  }
+  std::string clean;
+  clean.reserve(sql.size());
+  for (size_t pos = 0; pos < sql.size();) {
+    if (sql.compare(pos, 2, "/*") == 0) {
+      size_t close = sql.find("*/", pos + 2);
+      if (close != std::string::npos) {
+        clean.push_back(' ');
+        pos = close + 2;
+        continue;
       }
-    } else {
-      bool is_vector_query = (sql_.find("cosine_distance") != std::string::npos ||
-                              sql_.find("l2_distance") != std::string::npos ||
-                              sql_.find("inner_product") != std::string::npos);
-      (void)is_vector_query;
-      ret = seekdb_query(conn_->handle, sql_.c_str(), &seekdb_result);
     }
-    
-    if (ret != SEEKDB_SUCCESS) {
-      // Use connection-specific error first, fallback to thread-local error
-      const char* error_msg = seekdb_error(conn_->handle);
-      if (!error_msg) {
-        error_msg = seekdb_last_error();
-      }
-      std::string error_str = error_msg ? error_msg : "Query failed";
-      SetError(error_str);
+    clean.push_back(sql[pos++]);
+  }
+  for (const char* marker : {"--", "#"}) {
+    for (size_t pos = clean.find(marker); pos != std::string::npos; pos = clean.find(marker, pos + 1)) {
+      size_t eol = clean.find('\n', pos);
+      clean.replace(pos, (eol == std::string::npos ? clean.size() : eol) - pos, " ");
+    }
+  }
+  UnquoteGeneratedSql(&clean);  // Only trims here: quotes were already removed
+  auto upper_equal = [](char a, char b) {
+    return std::toupper(static_cast<unsigned char>(a)) == b;
+  };
+  if (clean.size() < 6 || !std::equal(clean.begin(), clean.begin() + 6, "SELECT", upper_equal)) {
+    *error = "Invalid SQL query: must start with SELECT";
+    return false;
+  }
+  static const char* const kDangerousKeywords[] = {
+    "DROP", "DELETE", "UPDATE", "INSERT", "ALTER", "CREATE", "GRANT", "REVOKE", "TRUNCATE",
+    "REPLACE", "RENAME", "LOAD_FILE", "OUTFILE", "DUMPFILE", "INTO OUTFILE", "INTO DUMPFILE",
+    "CALL", "LOAD",
+  };
+  for (const char* keyword : kDangerousKeywords) {
+    if (ContainsWord(clean, keyword)) {
+      *error = std::string("Dangerous SQL keyword detected: ") + keyword;
+      return false;
+    }
+  }
+  size_t statements = 0;
+  size_t start = 0;
+  for (size_t pos = 0; pos <= clean.size(); pos++) {
+    if (pos == clean.size() || clean[pos] == ';') {
+      if (clean.find_first_not_of(" \t\n\r\f\v", start) < pos) {
+        statements++;
+      }
+      start = pos + 1;
+    }
+  }
+  if (statements > 1) {
+    *error = "Multiple SQL statements are not allowed";
+    return false;
+  }
+  return true;
+}
+
+// Async worker for hybrid_search: sets @search_parm, asks DBMS_HYBRID_SEARCH.GET_SQL for the
+// search SQL, validates it and runs it on one connection in a single worker hop. Pools need the
+// single hop anyway: the user variable only exists on the connection that set it.
+class HybridSearchWorker : public SeekdbAsyncWorker {
+ public:
+  HybridSearchWorker(Napi::Promise::Deferred deferred, SeekdbExecuteTarget target, SeekdbQuery set_parm,
+                     std::string get_sql, const ExecuteOptions& options, bool generate_only)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred), target_(std::move(target)),
+      set_parm_(std::move(set_parm)), get_sql_(std::move(get_sql)), options_(options),
+      generate_only_(generate_only) {}
+
+ protected:
+  void Execute() override {
+    PoolLease lease(target_.pool);
+    std::string error;
+    SeekdbConnection* conn = AcquireTargetConnection(target_, lease, &error);
+    if (!conn) {
+      SetError(error);
+      return;
+    }
+    
+    SeekdbResult seekdb_result = nullptr;
+    if (!set_parm_.Run(conn, &seekdb_result, &error)) {
+      SetError("Failed to set search_parm: " + error);
+      return;
+    }
+    if (seekdb_result) {
+      seekdb_result_free(seekdb_result);
+    }
+    if (!QueryString(conn, get_sql_.c_str(), scratch_, &sql_, &has_sql_, &error)) {
+      SetError("DBMS_HYBRID_SEARCH.GET_SQL failed: " + error);
+      return;
+    }
+    if (!has_sql_) {
+      return;
+    }
+    UnquoteGeneratedSql(&sql_);
+    if (!ValidateGeneratedSql(sql_, &error)) {
+      SetError(error);
+      return;
+    }
+    if (generate_only_) {
       return;
     }
     
-    // If query succeeded but result is null, try to get stored result
-    // Note: For DML statements (INSERT/UPDATE/DELETE), result may be null but query succeeded
-    // This is normal for DML statements, we should create an empty result set
-    if (!seekdb_result) {
-      seekdb_result = seekdb_store_result(conn_->handle);
+    SeekdbQuery query(AnalyzeStatement(sql_));
+    if (!query.Run(conn, &seekdb_result, &error)) {
+      SetError(error);
+      return;
     }
-    if (!seekdb_result) {
-      result_ = nullptr;
-    } else {
+    if (seekdb_result) {
       try {
-        result_ = new SeekdbResultWrapper(seekdb_result);
+        std::unique_ptr<SeekdbResultWrapper> wrapper(new SeekdbResultWrapper(seekdb_result));
+        if (DecodeResult(wrapper.get(), &decoded_, scratch_, options_)) {
+          SetError(ResultLimitError(options_));
+        }
       } catch (const std::bad_alloc& e) {
         SetError("Memory allocation failed: " + std::string(e.what()));
-        return;
-      } catch (const std::exception& e) {
-        SetError("Exception in Execute: " + std::string(e.what()));
-        return;
       }
     }
   }
@@ -479,204 +2908,274 @@ class ExecuteWorker : public Napi::AsyncWorker {
   void OnOK() override {
     Napi::Env env = Env();
     Napi::HandleScope scope(env);
-    
-    // Handle queries with null result (empty result set)
-    // This can happen for:
-    // 1. DML statements (INSERT/UPDATE/DELETE) - normal, return empty result
-    // 2. SELECT queries with no matching rows - also normal, return empty result with columns
-    // Reference implementation creates empty result set in both cases
-    if (!result_) {
-      auto result_obj = Napi::Object::New(env);
-      auto columns = Napi::Array::New(env, 0);
-      auto rows = Napi::Array::New(env, 0);
-      result_obj.Set("columns", columns);
-      result_obj.Set("rows", rows);
-      deferred_.Resolve(result_obj);
+    Napi::Object result;
+    try {
+      result = ResultBufferToObject(env, decoded_, options_);
+    } catch (const Napi::Error& e) {
+      deferred_.Reject(e.Value());
+      return;
+    }
+    result.Set("sql", has_sql_ ? Napi::Value(Napi::String::New(env, sql_)) : env.Null());
+    deferred_.Resolve(result);
+  }
+
+  void OnError(const Napi::Error& e) override {
+    deferred_.Reject(e.Value());
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  SeekdbExecuteTarget target_;
+  SeekdbQuery set_parm_;
+  std::string get_sql_;
+  ExecuteOptions options_;
+  bool generate_only_;
+  bool has_sql_ = false;
+  std::string sql_;  // Validated generated SQL
+  SeekdbResultBuffer decoded_;
+  SeekdbScratchBuffer scratch_;
+};
+
+// Default rows per INSERT statement issued by bulk_insert()
+#define SEEKDB_DEFAULT_BULK_CHUNK_ROWS 1000
+// Placeholder limit per statement; bulk_insert() shrinks chunks of wide tables to stay below it
+#define SEEKDB_MAX_BULK_PARAMS 65535
+
+// One bulk_insert() column. Cells are copied once on the main thread into flat arenas; the
+// worker binds each chunk straight from them, so no per-cell std::string or bind buffer is built.
+struct SeekdbBulkColumn {
+  std::string name;
+  bool binary_id = false;              // Placeholder is CAST(? AS BINARY) (_id columns)
+  bool update = false;                 // Overwritten by ON DUPLICATE KEY UPDATE (upserts)
+  std::vector<SeekdbFieldType> types;  // Per row: NULL, STRING, LONGLONG, DOUBLE or TINY
+  std::vector<double> numbers;         // Per row: numeric and boolean (1/0) cells
+  std::string text;                    // String cells, concatenated
+  std::vector<size_t> text_ends;       // Per row: end of the cell in text (starts at text_ends[row - 1])
+  std::vector<float> floats;           // Float32Array cells (VECTOR), concatenated
+  std::vector<size_t> float_ends;      // Per row: end of the cell in floats
+
+  size_t RowCount() const { return types.size(); }
+  size_t TextBegin(size_t row) const { return row == 0 ? 0 : text_ends[row - 1]; }
+  size_t FloatBegin(size_t row) const { return row == 0 ? 0 : float_ends[row - 1]; }
+
+  void Reserve(size_t rows) {
+    types.reserve(rows);
+    numbers.reserve(rows);
+    text_ends.reserve(rows);
+    float_ends.reserve(rows);
+  }
+
+  void AppendNumber(SeekdbFieldType type, double value) {
+    types.push_back(type);
+    numbers.push_back(value);
+    text_ends.push_back(text.size());
+    float_ends.push_back(floats.size());
+  }
+
+  void AppendText(const std::string& value) {
+    text.append(value);
+    AppendNumber(SEEKDB_TYPE_STRING, 0);
+  }
+
+  void AppendVector(const float* values, size_t count) {
+    floats.insert(floats.end(), values, values + count);
+    AppendNumber(SEEKDB_TYPE_STRING, 0);
+  }
+
+  bool IsVector(size_t row) const { return float_ends[row] > FloatBegin(row); }
+};
+
+template <typename T>
+static void AppendTypedNumbers(const Napi::TypedArray& array, SeekdbBulkColumn* column) {
+  const T* data = reinterpret_cast<const T*>(
+      static_cast<const uint8_t*>(array.ArrayBuffer().Data()) + array.ByteOffset());
+  size_t count = array.ElementLength();
+  column->Reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    double value = static_cast<double>(data[i]);
+    column->AppendNumber(value == static_cast<int64_t>(value) ? SEEKDB_TYPE_LONGLONG : SEEKDB_TYPE_DOUBLE,
+                         value);
+  }
+}
+
+// Copy the cells of one bulk_insert() column: an Array (same value rules as execute() params) or a
+// numeric TypedArray. Main thread.
+static void LoadBulkColumn(Napi::Env env, Napi::Value data, SeekdbBulkColumn* column) {
+  if (data.IsTypedArray()) {
+    auto array = data.As<Napi::TypedArray>();
+    switch (array.TypedArrayType()) {
+      case napi_int8_array: AppendTypedNumbers<int8_t>(array, column); return;
+      case napi_uint8_array:
+      case napi_uint8_clamped_array: AppendTypedNumbers<uint8_t>(array, column); return;
+      case napi_int16_array: AppendTypedNumbers<int16_t>(array, column); return;
+      case napi_uint16_array: AppendTypedNumbers<uint16_t>(array, column); return;
+      case napi_int32_array: AppendTypedNumbers<int32_t>(array, column); return;
+      case napi_uint32_array: AppendTypedNumbers<uint32_t>(array, column); return;
+      case napi_float32_array: AppendTypedNumbers<float>(array, column); return;
+      case napi_float64_array: AppendTypedNumbers<double>(array, column); return;
+      default:
+        throw Napi::TypeError::New(env, "Column " + column->name + ": unsupported typed array");
+    }
+  }
+  if (!data.IsArray()) {
+    throw Napi::TypeError::New(env, "Column " + column->name + ": expected an array of values");
+  }
+  
+  auto array = data.As<Napi::Array>();
+  uint32_t count = array.Length();
+  column->Reserve(count);
+  for (uint32_t i = 0; i < count; i++) {
+    Napi::HandleScope scope(env);
+    Napi::Value value = array.Get(i);
+    if (value.IsNull() || value.IsUndefined()) {
+      column->AppendNumber(SEEKDB_TYPE_NULL, 0);
+    } else if (value.IsString()) {
+      column->AppendText(value.As<Napi::String>().Utf8Value());
+    } else if (value.IsNumber()) {
+      double num_val = value.As<Napi::Number>().DoubleValue();
+      column->AppendNumber(
+          num_val == static_cast<int64_t>(num_val) ? SEEKDB_TYPE_LONGLONG : SEEKDB_TYPE_DOUBLE, num_val);
+    } else if (value.IsBoolean()) {
+      column->AppendNumber(SEEKDB_TYPE_TINY, value.As<Napi::Boolean>().Value() ? 1 : 0);
+    } else if (value.IsTypedArray() &&
+               value.As<Napi::TypedArray>().TypedArrayType() == napi_float32_array) {
+      auto vector = value.As<Napi::Float32Array>();
+      column->AppendVector(vector.Data(), vector.ElementLength());
+    } else {
+      column->AppendText(value.ToString().Utf8Value());
+    }
+  }
+}
+
+// Quote a table or column name as a MySQL identifier
+static std::string QuoteIdentifier(const std::string& name) {
+  std::string quoted = "`";
+  for (char c : name) {
+    quoted.push_back(c);
+    if (c == '`') {
+      quoted.push_back('`');
+    }
+  }
+  quoted.push_back('`');
+  return quoted;
+}
+
+// Async worker for bulk_insert: issues chunked multi-row INSERTs on one connection, binding each
+// chunk directly from the columnar arenas. Columns flagged update turn each INSERT into an
+// upsert (ON DUPLICATE KEY UPDATE col = VALUES(col)). Bind storage is sized for one chunk and reused, so
+// native memory beyond the copied cells is bounded by chunk size.
+class BulkInsertWorker : public SeekdbAsyncWorker {
+ public:
+  BulkInsertWorker(Napi::Promise::Deferred deferred, SeekdbExecuteTarget target, std::string table,
+                   std::vector<SeekdbBulkColumn> columns, size_t row_count, size_t chunk_rows,
+                   bool transactional)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred), target_(std::move(target)),
+      table_(std::move(table)), columns_(std::move(columns)), row_count_(row_count),
+      chunk_rows_(chunk_rows), transactional_(transactional), inserted_(0) {}
+
+ protected:
+  void Execute() override {
+    PoolLease lease(target_.pool);
+    std::string error;
+    SeekdbConnection* conn = AcquireTargetConnection(target_, lease, &error);
+    if (!conn) {
+      SetError(error);
       return;
     }
     
-    // Build result object
-    auto result_obj = Napi::Object::New(env);
-    
-    // Set columns - ensure we have valid column names
-    auto columns = Napi::Array::New(env, result_->column_names.size());
-    for (size_t i = 0; i < result_->column_names.size(); i++) {
-      // Ensure column name is not empty
-      std::string col_name = result_->column_names[i];
-      if (col_name.empty()) {
-        col_name = "col_" + std::to_string(i);
+    const size_t column_count = columns_.size();
+    const size_t chunk = std::max<size_t>(1, std::min(chunk_rows_, SEEKDB_MAX_BULK_PARAMS / column_count));
+    std::string prefix = "INSERT INTO " + QuoteIdentifier(table_) + " (";
+    std::string row_sql = "(";
+    for (size_t c = 0; c < column_count; c++) {
+      if (c > 0) {
+        prefix += ", ";
+        row_sql += ", ";
+      }
+      prefix += QuoteIdentifier(columns_[c].name);
+      row_sql += columns_[c].binary_id ? "CAST(? AS BINARY)" : "?";
+    }
+    prefix += ") VALUES ";
+    row_sql += ")";
+    std::string suffix;
+    for (const SeekdbBulkColumn& column : columns_) {
+      if (column.update) {
+        suffix += suffix.empty() ? " ON DUPLICATE KEY UPDATE " : ", ";
+        suffix += QuoteIdentifier(column.name) + " = VALUES(" + QuoteIdentifier(column.name) + ")";
       }
-      columns.Set(i, Napi::String::New(env, col_name));
     }
-    result_obj.Set("columns", columns);
     
-    // Validate result handle
-    if (!result_->result) {
-      deferred_.Reject(Napi::Error::New(env, "Result handle is null").Value());
+    try {
+      const size_t max_params = std::min(chunk, row_count_) * column_count;
+      binds_.resize(max_params);
+      lengths_.resize(max_params);
+      null_flags_.resize(max_params);
+      int_values_.resize(max_params);
+      double_values_.resize(max_params);
+      bool_values_.resize(max_params);
+      vector_text_.resize(max_params);
+    } catch (const std::bad_alloc& e) {
+      SetError("Memory allocation failed: " + std::string(e.what()));
       return;
     }
     
-    if (result_->column_count == 0) {
-      auto rows = Napi::Array::New(env, 0);
-      result_obj.Set("rows", rows);
-      deferred_.Resolve(result_obj);
+    // A single chunk is one statement and already atomic
+    const bool transactional = transactional_ && row_count_ > chunk;
+    if (transactional && !RunSimpleQuery(conn, "BEGIN", &error)) {
+      SetError("Failed to begin transaction: " + error);
       return;
     }
-    auto rows = Napi::Array::New(env, result_->row_count);
-    bool has_field_info = !result_->field_info.empty() && result_->field_info.size() == static_cast<size_t>(result_->column_count);
-    for (int64_t i = 0; i < result_->row_count; i++) {
-      SeekdbRow row = seekdb_fetch_row(result_->result);
-      if (row) {
-        auto row_obj = Napi::Array::New(env, result_->column_count);
-        
-        for (int32_t j = 0; j < result_->column_count; j++) {
-          const std::string& col_name = (j < static_cast<int32_t>(result_->column_names.size())) ? result_->column_names[j] : ("col_" + std::to_string(j));
-          bool row_is_null = seekdb_row_is_null(row, j);
-          // When C ABI reports null: try 2MB buffer first (long TEXT may be wrongly reported as null); if non-empty use it. If 2MB returns empty and str_len==0 treat as ""; if 2MB fails do not fall back to 1-byte (column may be long), set null.
-          if (row_is_null) {
-            size_t str_len = seekdb_row_get_string_len(row, j);
-            const size_t fallback_buf_size = 2 * 1024 * 1024;
-            std::vector<char> buf(fallback_buf_size, 0);
-            int get_ret = seekdb_row_get_string(row, j, buf.data(), buf.size());
-            if (get_ret == SEEKDB_SUCCESS && buf[0] != '\0') {
-              row_obj.Set(j, Napi::String::New(env, buf.data()));
-            } else if (get_ret == SEEKDB_SUCCESS && str_len == 0) {
-              row_obj.Set(j, Napi::String::New(env, ""));
-            } else if (get_ret == SEEKDB_SUCCESS) {
-              row_obj.Set(j, env.Null());
-            } else {
-              // 2MB failed: do not try 1-byte (may be long content); set null
-              row_obj.Set(j, env.Null());
-            }
-          } else {
-            // Use field type information if available for optimized type detection
-            if (has_field_info && result_->field_info[j]) {
-              SeekdbField* field = result_->field_info[j];
-              int32_t field_type = field->type;
-              
-              // Map MySQL field type to appropriate getter
-              // Field types align with SeekdbFieldType enum values:
-              // SEEKDB_TYPE_TINY=1, SHORT=2, LONG=3, LONGLONG=4
-              // SEEKDB_TYPE_FLOAT=5, DOUBLE=6
-              // SEEKDB_TYPE_STRING=11, BLOB=12
-              bool value_set = false;
-              
-              // Try integer types (TINY, SHORT, LONG, LONGLONG) - types 1-4
-              if (field_type >= 1 && field_type <= 4) {
-                // For TINY (type 1), try boolean first if it makes sense
-                if (field_type == 1) {
-                  bool bool_val;
-                  if (seekdb_row_get_bool(row, j, &bool_val) == SEEKDB_SUCCESS) {
-                    row_obj.Set(j, Napi::Boolean::New(env, bool_val));
-                    value_set = true;
-                  }
-                }
-                // If boolean failed or not TINY, try int64
-                if (!value_set) {
-                  int64_t int_val;
-                  if (seekdb_row_get_int64(row, j, &int_val) == SEEKDB_SUCCESS) {
-                    row_obj.Set(j, Napi::Number::New(env, static_cast<double>(int_val)));
-                    value_set = true;
-                  }
-                }
-              }
-              // Try floating point types (FLOAT, DOUBLE) - types 5-6
-              else if (field_type == 5 || field_type == 6) {
-                double double_val;
-                if (seekdb_row_get_double(row, j, &double_val) == SEEKDB_SUCCESS) {
-                  row_obj.Set(j, Napi::Number::New(env, double_val));
-                  value_set = true;
-                }
-              }
-              
-              // For STRING/BLOB types (11-12): string getter. For VECTOR (40/13): C ABI may return JSON string (vector_binary_to_json) or binary; return as string so SDK can JSON.parse, or fallback to parseEmbeddingBinaryString for binary.
-              if (!value_set || field_type == 11 || field_type == 12 || field_type == 40 || field_type == 13) {
-                size_t str_len = seekdb_row_get_string_len(row, j);
-                const size_t max_safe_len = 10 * 1024 * 1024;  // 10MB cap to avoid OOM
-                const size_t fallback_buf_size = 2 * 1024 * 1024;  // 2MB for long document/metadata
-                bool string_set = false;
-                // When C ABI returns valid length for STRING/BLOB/VECTOR (and not 0 for long content)
-                if (str_len != static_cast<size_t>(-1) && str_len > 0 && str_len <= max_safe_len) {
-                  std::vector<char> buf(str_len + 1);
-                  if (seekdb_row_get_string(row, j, buf.data(), buf.size()) == SEEKDB_SUCCESS) {
-                    row_obj.Set(j, Napi::String::New(env, buf.data()));
-                    string_set = true;
-                  }
-                }
-                // When C ABI returns -1 or 0 for length (e.g. long TEXT/BLOB or wrong len): try large buffer for string-like columns
-                if (!string_set && (field_type == 11 || field_type == 12 || field_type == 40 || field_type == 13 || !value_set)) {
-                  std::vector<char> buf(fallback_buf_size, 0);
-                  if (seekdb_row_get_string(row, j, buf.data(), buf.size()) == SEEKDB_SUCCESS) {
-                    row_obj.Set(j, Napi::String::New(env, buf.data()));
-                    string_set = true;
-                  }
-                }
-                if (!string_set) {
-                  row_obj.Set(j, env.Null());
-                }
-              }
-            } else {
-              // Fallback: get string length first when available to support long TEXT/BLOB (e.g. 100KB document)
-              size_t str_len = seekdb_row_get_string_len(row, j);
-              const size_t max_safe_len = 10 * 1024 * 1024;  // 10MB cap to avoid OOM
-              const size_t fallback_buf_size = 2 * 1024 * 1024;  // 2MB when length unknown
-              if (str_len != static_cast<size_t>(-1) && str_len <= max_safe_len) {
-                std::vector<char> buf(str_len + 1, 0);
-                int ret = seekdb_row_get_string(row, j, buf.data(), buf.size());
-                if (ret == SEEKDB_SUCCESS) {
-                  row_obj.Set(j, Napi::String::New(env, buf.data()));
-                } else {
-                  row_obj.Set(j, env.Null());
-                }
-              } else if (str_len == static_cast<size_t>(-1)) {
-                // Length unknown (e.g. long TEXT/BLOB): try large buffer so long document/metadata not truncated
-                std::vector<char> buf(fallback_buf_size, 0);
-                int ret = seekdb_row_get_string(row, j, buf.data(), buf.size());
-                if (ret == SEEKDB_SUCCESS) {
-                  row_obj.Set(j, Napi::String::New(env, buf.data()));
-                } else {
-                  row_obj.Set(j, env.Null());
-                }
-              } else {
-                // Length > 10MB: use fixed buffer (e.g. for numeric/boolean columns or legacy path)
-                std::vector<char> buf(4096, 0);
-                int ret = seekdb_row_get_string(row, j, buf.data(), buf.size());
-                if (ret == SEEKDB_SUCCESS) {
-                  std::string str_val(buf.data());
-                  if (!str_val.empty()) {
-                    char* end_ptr = nullptr;
-                    double num_val = std::strtod(str_val.c_str(), &end_ptr);
-                    if (*end_ptr == '\0' && end_ptr != str_val.c_str()) {
-                      if (num_val == static_cast<int64_t>(num_val)) {
-                        row_obj.Set(j, Napi::Number::New(env, static_cast<double>(static_cast<int64_t>(num_val))));
-                      } else {
-                        row_obj.Set(j, Napi::Number::New(env, num_val));
-                      }
-                    } else if (str_val == "true" || str_val == "1") {
-                      row_obj.Set(j, Napi::Boolean::New(env, true));
-                    } else if (str_val == "false" || str_val == "0") {
-                      row_obj.Set(j, Napi::Boolean::New(env, false));
-                    } else {
-                      row_obj.Set(j, Napi::String::New(env, str_val));
-                    }
-                  } else {
-                    row_obj.Set(j, env.Null());
-                  }
-                } else {
-                  row_obj.Set(j, env.Null());
-                }
-              }
-            }
+    std::string sql;
+    size_t sql_rows = 0;
+    for (size_t start = 0; start < row_count_; start += chunk) {
+      const size_t rows = std::min(chunk, row_count_ - start);
+      if (rows != sql_rows) {
+        // Only the last chunk can be shorter, so the statement text is built at most twice
+        sql = prefix;
+        sql.reserve(prefix.size() + rows * (row_sql.size() + 2) + suffix.size());
+        for (size_t r = 0; r < rows; r++) {
+          if (r > 0) {
+            sql += ", ";
           }
+          sql += row_sql;
         }
-        
-        rows.Set(i, row_obj);
-      } else {
-        break;
+        sql += suffix;
+        sql_rows = rows;
+      }
+      BindChunk(start, rows);
+      
+      SeekdbResult result = nullptr;
+      int ret = seekdb_query_with_params(conn->handle, sql.c_str(), &result, binds_.data(),
+                                         static_cast<unsigned int>(rows * column_count));
+      if (ret != SEEKDB_SUCCESS) {
+        const char* error_msg = seekdb_error(conn->handle);
+        if (!error_msg) {
+          error_msg = seekdb_last_error();
+        }
+        if (transactional) {
+          std::string rollback_error;
+          RunSimpleQuery(conn, "ROLLBACK", &rollback_error);
+        }
+        SetError("Rows " + std::to_string(start) + "-" + std::to_string(start + rows - 1) +
+                 " failed: " + (error_msg ? error_msg : "Query failed"));
+        return;
       }
+      if (result) {
+        seekdb_result_free(result);
+      }
+      inserted_ += rows;
     }
-    result_obj.Set("rows", rows);
-    deferred_.Resolve(result_obj);
+    if (transactional && !RunSimpleQuery(conn, "COMMIT", &error)) {
+      std::string rollback_error;
+      RunSimpleQuery(conn, "ROLLBACK", &rollback_error);
+      SetError("Failed to commit transaction: " + error);
+    }
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    deferred_.Resolve(Napi::Number::New(env, static_cast<double>(inserted_)));
   }
 
   void OnError(const Napi::Error& e) override {
@@ -684,28 +3183,351 @@ class ExecuteWorker : public Napi::AsyncWorker {
   }
 
  private:
+  // Point binds_[0, rows * columns) at rows [start, start + rows). Worker thread.
+  void BindChunk(size_t start, size_t rows) {
+    size_t p = 0;
+    for (size_t row = start; row < start + rows; row++) {
+      for (const SeekdbBulkColumn& column : columns_) {
+        SeekdbBind& bind = binds_[p];
+        bind = {};
+        null_flags_[p] = 0;
+        bind.is_null = reinterpret_cast<bool*>(&null_flags_[p]);
+        switch (column.types[row]) {
+          case SEEKDB_TYPE_NULL:
+            null_flags_[p] = 1;
+            bind.buffer_type = SEEKDB_TYPE_NULL;
+            break;
+          case SEEKDB_TYPE_LONGLONG:
+            int_values_[p] = static_cast<int64_t>(column.numbers[row]);
+            bind.buffer_type = SEEKDB_TYPE_LONGLONG;
+            bind.buffer = &int_values_[p];
+            bind.buffer_length = sizeof(int64_t);
+            break;
+          case SEEKDB_TYPE_DOUBLE:
+            double_values_[p] = column.numbers[row];
+            bind.buffer_type = SEEKDB_TYPE_DOUBLE;
+            bind.buffer = &double_values_[p];
+            bind.buffer_length = sizeof(double);
+            break;
+          case SEEKDB_TYPE_TINY:
+            bool_values_[p] = column.numbers[row] != 0 ? 1 : 0;
+            bind.buffer_type = SEEKDB_TYPE_TINY;
+            bind.buffer = &bool_values_[p];
+            bind.buffer_length = sizeof(uint8_t);
+            break;
+          default: {
+            // String cell, or a VECTOR cell formatted to its text literal
+            const char* data;
+            size_t len;
+            if (column.IsVector(row)) {
+              size_t begin = column.FloatBegin(row);
+              FormatVectorText(column.floats.data() + begin, column.float_ends[row] - begin, &vector_text_[p]);
+              data = vector_text_[p].data();
+              len = vector_text_[p].size();
+            } else {
+              size_t begin = column.TextBegin(row);
+              data = column.text.data() + begin;
+              len = column.text_ends[row] - begin;
+            }
+            lengths_[p] = len;
+            bind.buffer_type = column.binary_id ? SEEKDB_TYPE_VARBINARY_ID : SEEKDB_TYPE_STRING;
+            bind.buffer = const_cast<char*>(data);
+            bind.buffer_length = len;
+            bind.length = &lengths_[p];
+            break;
+          }
+        }
+        p++;
+      }
+    }
+  }
+
   Napi::Promise::Deferred deferred_;
-  SeekdbConnection* conn_;
-  std::string sql_;
-  bool has_params_;
-  
-  // Pre-extracted parameter values (extracted in constructor on main thread)
-  uint32_t param_count_;
-  std::vector<SeekdbFieldType> param_types_;
-  std::vector<std::string> param_strings_;
-  std::vector<double> param_numbers_;
-  std::vector<bool> param_bools_;
+  SeekdbExecuteTarget target_;
+  std::string table_;
+  std::vector<SeekdbBulkColumn> columns_;
+  size_t row_count_;
+  size_t chunk_rows_;
+  bool transactional_;
+  size_t inserted_;
   
-  // Buffer storage for parameter binding (kept alive during execution)
+  // Bind storage for one chunk, indexed by placeholder position
   std::vector<SeekdbBind> binds_;
-  std::vector<std::vector<char>> string_buffers_;
   std::vector<unsigned long> lengths_;
-  std::vector<uint8_t> null_flags_;  // Use uint8_t instead of bool (std::vector<bool> is specialized and can't take address)
+  std::vector<uint8_t> null_flags_;  // uint8_t: std::vector<bool> can't hand out pointers
   std::vector<int64_t> int_values_;
   std::vector<double> double_values_;
-  std::vector<uint8_t> bool_values_;  // Use uint8_t instead of bool (std::vector<bool> is specialized and can't take address)
-  
-  SeekdbResultWrapper* result_;
+  std::vector<uint8_t> bool_values_;
+  std::vector<std::string> vector_text_;  // VECTOR literals of the current chunk
+};
+
+// Async worker for fetch_next: decodes the next batch of a cursor on the worker thread
+class FetchWorker : public SeekdbAsyncWorker {
+ public:
+  FetchWorker(Napi::Promise::Deferred deferred, Napi::Value cursor_value, SeekdbResultWrapper* cursor,
+              int64_t batch_size)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred),
+      cursor_ref_(Napi::Reference<Napi::Value>::New(cursor_value, 1)),  // Keep the cursor alive while fetching
+      cursor_(cursor), batch_size_(batch_size) {
+    cursor_->fetching = true;
+  }
+
+ protected:
+  void Execute() override {
+    try {
+      // Past maxResultBytes the batch just ends early; the next fetch_next() continues
+      DecodeResult(cursor_, &decoded_, scratch_, cursor_->options, batch_size_);
+    } catch (const std::bad_alloc& e) {
+      SetError("Memory allocation failed: " + std::string(e.what()));
+    } catch (const std::exception& e) {
+      SetError("Exception in fetch: " + std::string(e.what()));
+    }
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    cursor_->fetching = false;
+    try {
+      deferred_.Resolve(ResultBufferToObject(env, decoded_, cursor_->options));
+    } catch (const Napi::Error& e) {
+      deferred_.Reject(e.Value());
+    }
+  }
+
+  void OnError(const Napi::Error& e) override {
+    cursor_->fetching = false;
+    deferred_.Reject(e.Value());
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  Napi::Reference<Napi::Value> cursor_ref_;
+  SeekdbResultWrapper* cursor_;
+  int64_t batch_size_;
+  SeekdbResultBuffer decoded_;
+  SeekdbScratchBuffer scratch_;
+};
+
+// Bm25Options of bm25_encode(). Main thread.
+static std::shared_ptr<SeekdbBm25Options> ParseBm25Options(Napi::Env env, Napi::Value value) {
+  auto options = std::make_shared<SeekdbBm25Options>();
+  if (value.IsUndefined() || value.IsNull()) {
+    return options;
+  }
+  if (!value.IsObject()) {
+    throw Napi::TypeError::New(env, "Expected options to be an object");
+  }
+  auto obj = value.As<Napi::Object>();
+  auto number = [&env, &obj](const char* name, double fallback) {
+    Napi::Value v = obj.Get(name);
+    if (v.IsUndefined()) {
+      return fallback;
+    }
+    double n = v.IsNumber() ? v.As<Napi::Number>().DoubleValue() : 0;
+    if (!std::isfinite(n) || n <= 0) {
+      throw Napi::TypeError::New(env, std::string(name) + " must be a positive number");
+    }
+    return n;
+  };
+  options->k = number("k", options->k);
+  Napi::Value b = obj.Get("b");
+  if (!b.IsUndefined()) {
+    options->b = b.IsNumber() ? b.As<Napi::Number>().DoubleValue() : -1;
+    if (!(options->b >= 0 && options->b <= 1)) {
+      throw Napi::TypeError::New(env, "b must be a number in [0, 1]");
+    }
+  }
+  options->avg_doc_length = number("avgDocLength", options->avg_doc_length);
+  options->token_max_length =
+      static_cast<size_t>(number("tokenMaxLength", static_cast<double>(options->token_max_length)));
+  options->max_dimension =
+      static_cast<int64_t>(number("maxDimension", static_cast<double>(options->max_dimension)));
+  Napi::Value stopwords = obj.Get("stopwords");
+  if (!stopwords.IsUndefined()) {
+    if (!stopwords.IsArray()) {
+      throw Napi::TypeError::New(env, "stopwords must be an array of strings");
+    }
+    auto list = stopwords.As<Napi::Array>();
+    for (uint32_t i = 0; i < list.Length(); i++) {
+      options->stopwords.insert(list.Get(i).ToString().Utf8Value());
+    }
+  } else {
+    options->stopwords = {"a", "an", "and", "are", "as", "at", "be", "by", "for", "from", "has", "he", "in",
+                          "is", "it", "its", "of", "on", "that", "the", "to", "was", "were", "will", "with"};
+  }
+  return options;
+}
+
+// Encodes a batch of texts into BM25 sparse literals on a worker thread (bm25_encode())
+class Bm25Worker : public SeekdbAsyncWorker {
+ public:
+  Bm25Worker(Napi::Promise::Deferred deferred, std::shared_ptr<const SeekdbBm25Options> options,
+             std::vector<std::string> texts)
+    : SeekdbAsyncWorker(deferred.Env()), deferred_(deferred), options_(std::move(options)),
+      texts_(std::move(texts)) {}
+
+ protected:
+  void Execute() override {
+    literals_.resize(texts_.size());
+    encoded_.resize(texts_.size());
+    for (size_t i = 0; i < texts_.size(); i++) {
+      encoded_[i] = SeekdbBm25Encode(*options_, texts_[i], &literals_[i]) ? 1 : 0;
+    }
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    auto array = Napi::Array::New(env, literals_.size());
+    for (size_t i = 0; i < literals_.size(); i++) {
+      array.Set(static_cast<uint32_t>(i), encoded_[i] ? Napi::String::New(env, literals_[i]) : env.Null());
+    }
+    deferred_.Resolve(array);
+  }
+
+  void OnError(const Napi::Error& e) override {
+    deferred_.Reject(e.Value());
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  std::shared_ptr<const SeekdbBm25Options> options_;
+  std::vector<std::string> texts_;
+  std::vector<std::string> literals_;
+  std::vector<uint8_t> encoded_;  // 0: non-ASCII text, left to the caller
+};
+
+// info[index] as a Float32Array (the vector_* kernels). Main thread.
+static Napi::Float32Array Float32ArrayArg(const Napi::CallbackInfo& info, size_t index,
+                                          const char* name) {
+  if (info.Length() <= index || !info[index].IsTypedArray() ||
+      info[index].As<Napi::TypedArray>().TypedArrayType() != napi_float32_array) {
+    throw Napi::TypeError::New(info.Env(), std::string(name) + " must be a Float32Array");
+  }
+  return info[index].As<Napi::Float32Array>();
+}
+
+// metric argument of vector_distances(). Main thread.
+static SeekdbVectorMetric ParseVectorMetric(Napi::Env env, Napi::Value value) {
+  std::string metric = value.IsString() ? value.As<Napi::String>().Utf8Value() : "";
+  if (metric == "l2") {
+    return SeekdbVectorMetric::kL2;
+  }
+  if (metric == "cosine") {
+    return SeekdbVectorMetric::kCosine;
+  }
+  if (metric == "inner_product") {
+    return SeekdbVectorMetric::kInnerProduct;
+  }
+  throw Napi::TypeError::New(env, "metric must be \"l2\", \"cosine\" or \"inner_product\"");
+}
+
+// Progress event of open_async()/close_async(), delivered to the onProgress callback
+struct SeekdbLifecycleEvent {
+  const char* phase;  // Static string: "opening", "ready", "joined", "closing", "closed", "released"
+  double elapsed_ms;
+};
+
+// Base of OpenWorker/CloseWorker: reports lifecycle phases to an optional JS callback through the
+// worker's thread-safe progress queue, so engine startup and shutdown never block the event loop.
+class LifecycleWorker : public Napi::AsyncProgressQueueWorker<SeekdbLifecycleEvent> {
+ public:
+  LifecycleWorker(Napi::Promise::Deferred deferred, Napi::Value on_progress)
+    : Napi::AsyncProgressQueueWorker<SeekdbLifecycleEvent>(deferred.Env()), deferred_(deferred),
+      started_(std::chrono::steady_clock::now()) {
+    if (on_progress.IsFunction()) {
+      on_progress_ = Napi::Persistent(on_progress.As<Napi::Function>());
+    }
+  }
+
+ protected:
+  void Report(const ExecutionProgress& progress, const char* phase) {
+    if (on_progress_.IsEmpty()) {
+      return;
+    }
+    SeekdbLifecycleEvent event = {
+      phase, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started_).count()};
+    progress.Send(&event, 1);
+  }
+
+  void OnProgress(const SeekdbLifecycleEvent* events, size_t count) override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    for (size_t i = 0; i < count; i++) {
+      auto event = Napi::Object::New(env);
+      event.Set("phase", Napi::String::New(env, events[i].phase));
+      event.Set("elapsedMs", Napi::Number::New(env, events[i].elapsed_ms));
+      on_progress_.Value().Call({event});
+    }
+  }
+
+  void OnError(const Napi::Error& e) override {
+    deferred_.Reject(e.Value());
+  }
+
+  Napi::Promise::Deferred deferred_;
+
+ private:
+  Napi::FunctionReference on_progress_;
+  std::chrono::steady_clock::time_point started_;
+};
+
+// Async worker for open_async: starts (or joins) the engine on a worker thread
+class OpenWorker : public LifecycleWorker {
+ public:
+  OpenWorker(Napi::Promise::Deferred deferred, Napi::Value on_progress, std::string db_dir, bool with_service,
+             int port)
+    : LifecycleWorker(deferred, on_progress), db_dir_(std::move(db_dir)), with_service_(with_service),
+      port_(port) {}
+
+ protected:
+  void Execute(const ExecutionProgress& progress) override {
+    Report(progress, "opening");
+    std::string error;
+    bool joined = false;
+    if (!SeekdbEngineRegistry::Open(db_dir_, with_service_, port_, &error, &joined)) {
+      SetError(error);
+      return;
+    }
+    Report(progress, joined ? "joined" : "ready");
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    deferred_.Resolve(CreateExternal<SeekdbDatabase>(env, DatabaseTypeTag, new SeekdbDatabase(db_dir_)));
+  }
+
+ private:
+  std::string db_dir_;
+  bool with_service_;
+  int port_;
+};
+
+// Async worker for close_async: drops the engine reference of a database handle (already marked
+// closed on the main thread); the last reference closes the engine on the worker thread
+class CloseWorker : public LifecycleWorker {
+ public:
+  CloseWorker(Napi::Promise::Deferred deferred, Napi::Value on_progress, bool release)
+    : LifecycleWorker(deferred, on_progress), release_(release), closed_(false) {}
+
+ protected:
+  void Execute(const ExecutionProgress& progress) override {
+    Report(progress, "closing");
+    closed_ = release_ && SeekdbEngineRegistry::Release();
+    Report(progress, closed_ ? "closed" : "released");
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    deferred_.Resolve(Napi::Boolean::New(env, closed_));
+  }
+
+ private:
+  bool release_;  // The handle was still open
+  bool closed_;
 };
 
 // Main addon class
@@ -723,14 +3545,85 @@ class SeekdbNodeAddon : public Napi::Addon<SeekdbNodeAddon> {
       // function close_sync(database: Database): void
       InstanceMethod("close_sync", &SeekdbNodeAddon::close_sync),
       
+      // function open_async(db_dir?: string, options?: OpenOptions): Promise<Database>
+      InstanceMethod("open_async", &SeekdbNodeAddon::open_async),
+      
+      // function close_async(database: Database, options?: LifecycleOptions): Promise<boolean>
+      InstanceMethod("close_async", &SeekdbNodeAddon::close_async),
+      
       // function connect(database: Database, database_name: string, autocommit: boolean): Connection
       InstanceMethod("connect", &SeekdbNodeAddon::connect),
       
-      // function disconnect(connection: Connection): void
-      InstanceMethod("disconnect", &SeekdbNodeAddon::disconnect),
+      // function disconnect(connection: Connection): void
+      InstanceMethod("disconnect", &SeekdbNodeAddon::disconnect),
+      
+      // function execute(connection: Connection | Pool | Transaction, sql: string, params?: any[], options?: ExecuteOptions): Promise<Result>
+      InstanceMethod("execute", &SeekdbNodeAddon::execute),
+      
+      // function prepare(connection: Connection | Pool, sql: string): Statement
+      InstanceMethod("prepare", &SeekdbNodeAddon::prepare),
+      
+      // function execute_prepared(statement: Statement, params?: any[], options?: ExecuteOptions): Promise<Result>
+      InstanceMethod("execute_prepared", &SeekdbNodeAddon::execute_prepared),
+      
+      // function execute_stream(connection: Connection | Pool | Transaction, sql: string, params?: any[], options?: StreamOptions): Promise<Cursor>
+      InstanceMethod("execute_stream", &SeekdbNodeAddon::execute_stream),
+      
+      // function fetch_next(cursor: Cursor, batchSize?: number): Promise<Result>
+      InstanceMethod("fetch_next", &SeekdbNodeAddon::fetch_next),
+      
+      // function close_cursor(cursor: Cursor): void
+      InstanceMethod("close_cursor", &SeekdbNodeAddon::close_cursor),
+      
+      // function execute_batch(connection: Connection | Pool | Transaction, statements: BatchStatement[], options?: BatchOptions): Promise<Result[]>
+      InstanceMethod("execute_batch", &SeekdbNodeAddon::execute_batch),
+      
+      // function begin(connection: Connection | Pool): Promise<Transaction>
+      InstanceMethod("begin", &SeekdbNodeAddon::begin),
+      
+      // function commit(transaction: Transaction): Promise<void>
+      InstanceMethod("commit", &SeekdbNodeAddon::commit),
+      
+      // function rollback(transaction: Transaction): Promise<void>
+      InstanceMethod("rollback", &SeekdbNodeAddon::rollback),
+      
+      // function bulk_insert(connection: Connection | Pool | Transaction, table: string, columns: (string | BulkInsertColumn)[], data: (any[] | TypedArray)[], options?: BulkInsertOptions): Promise<number>
+      InstanceMethod("bulk_insert", &SeekdbNodeAddon::bulk_insert),
+      // function hybrid_search(connection: Connection | Pool | Transaction, table: string, search_parm: string, options?: HybridSearchOptions): Promise<HybridSearchResult>
+      InstanceMethod("hybrid_search", &SeekdbNodeAddon::hybrid_search),
+      
+      // function create_pool(database: Database, database_name: string, autocommit: boolean, options?: PoolOptions): Pool
+      InstanceMethod("create_pool", &SeekdbNodeAddon::create_pool),
+      
+      // function pool_stats(pool: Pool): PoolStats
+      InstanceMethod("pool_stats", &SeekdbNodeAddon::pool_stats),
+      
+      // function warm_pool(pool: Pool, connections: number): Promise<number>
+      InstanceMethod("warm_pool", &SeekdbNodeAddon::warm_pool),
+      
+      // function close_pool(pool: Pool): void
+      InstanceMethod("close_pool", &SeekdbNodeAddon::close_pool),
+      
+      // function configure(options: ExecutorOptions): void
+      InstanceMethod("configure", &SeekdbNodeAddon::configure),
+      
+      // function stats(connection: Connection | Pool | Transaction, reset?: boolean): QueryStats
+      InstanceMethod("stats", &SeekdbNodeAddon::stats),
+      
+      // function bm25_encode(texts: string[], options?: Bm25Options): Promise<(string | null)[]>
+      InstanceMethod("bm25_encode", &SeekdbNodeAddon::bm25_encode),
+      
+      // function vector_find_non_finite(data: Float32Array): number
+      InstanceMethod("vector_find_non_finite", &SeekdbNodeAddon::vector_find_non_finite),
+      
+      // function vector_normalize(vectors: Float32Array, dimension: number): Float32Array
+      InstanceMethod("vector_normalize", &SeekdbNodeAddon::vector_normalize),
+      
+      // function vector_distances(metric: VectorMetric, query: Float32Array, vectors: Float32Array): Float64Array
+      InstanceMethod("vector_distances", &SeekdbNodeAddon::vector_distances),
       
-      // function execute(connection: Connection, sql: string): Promise<Result>
-      InstanceMethod("execute", &SeekdbNodeAddon::execute),
+      // function vector_isa(): string
+      InstanceMethod("vector_isa", &SeekdbNodeAddon::vector_isa),
     });
   }
 
@@ -744,14 +3637,13 @@ class SeekdbNodeAddon : public Napi::Addon<SeekdbNodeAddon> {
       db_dir = info[0].As<Napi::String>().Utf8Value();
     }
     
-    // Call seekdb_open
-    int ret = seekdb_open(db_dir.empty() ? nullptr : db_dir.c_str());
-    if (ret != SEEKDB_SUCCESS) {
-      const char* error = seekdb_last_error();
-      throw Napi::Error::New(env, error ? error : "Failed to open database");
+    // Start the engine, or join it if another client or worker thread already opened it
+    std::string error;
+    if (!SeekdbEngineRegistry::Open(db_dir, false, 0, &error)) {
+      throw Napi::Error::New(env, error);
     }
     
-    // Create database wrapper (just a marker)
+    // Create database wrapper (holds one engine reference)
     auto db = new SeekdbDatabase(db_dir);
     
     return CreateExternal<SeekdbDatabase>(env, DatabaseTypeTag, db);
@@ -774,15 +3666,14 @@ class SeekdbNodeAddon : public Napi::Addon<SeekdbNodeAddon> {
       }
     }
     
-    // Call seekdb_open_with_service
+    // Call seekdb_open_with_service through the registry (joins a running engine; port is then ignored)
     // If port > 0, runs in server mode; if port <= 0, runs in embedded mode
-    int ret = seekdb_open_with_service(db_dir.empty() ? nullptr : db_dir.c_str(), port);
-    if (ret != SEEKDB_SUCCESS) {
-      const char* error = seekdb_last_error();
-      throw Napi::Error::New(env, error ? error : "Failed to open database with service");
+    std::string error;
+    if (!SeekdbEngineRegistry::Open(db_dir, true, port, &error)) {
+      throw Napi::Error::New(env, error);
     }
     
-    // Create database wrapper (just a marker)
+    // Create database wrapper (holds one engine reference)
     auto db = new SeekdbDatabase(db_dir);
     
     return CreateExternal<SeekdbDatabase>(env, DatabaseTypeTag, db);
@@ -793,19 +3684,71 @@ class SeekdbNodeAddon : public Napi::Addon<SeekdbNodeAddon> {
     auto env = info.Env();
     auto db = GetDatabaseFromExternal(env, info[0]);
     
-    // Call seekdb_close (global close)
-    seekdb_close();
-    
-    delete db;
+    // Drop this handle's engine reference; seekdb_close() runs once no handle or connection
+    // (in any thread) still uses the engine. The wrapper itself is freed by GC.
+    db->Close();
     
     return env.Undefined();
   }
   
+  // function open_async(db_dir?: string, options?: OpenOptions): Promise<Database>
+  Napi::Value open_async(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    std::string db_dir = "";
+    if (info.Length() > 0 && !info[0].IsUndefined() && !info[0].IsNull()) {
+      db_dir = info[0].As<Napi::String>().Utf8Value();
+    }
+    
+    // options.port selects seekdb_open_with_service() (port > 0 runs in server mode)
+    bool with_service = false;
+    int port = 0;
+    Napi::Value on_progress = env.Undefined();
+    if (info.Length() > 1 && info[1].IsObject()) {
+      auto obj = info[1].As<Napi::Object>();
+      Napi::Value port_value = obj.Get("port");
+      if (port_value.IsNumber()) {
+        with_service = true;
+        port = port_value.As<Napi::Number>().Int32Value();
+      }
+      on_progress = obj.Get("onProgress");
+    }
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new OpenWorker(deferred, on_progress, std::move(db_dir), with_service, port);
+    worker->Queue();
+    
+    return deferred.Promise();
+  }
+  
+  // function close_async(database: Database, options?: LifecycleOptions): Promise<boolean>
+  Napi::Value close_async(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto db = GetDatabaseFromExternal(env, info[0]);
+    
+    Napi::Value on_progress = env.Undefined();
+    if (info.Length() > 1 && info[1].IsObject()) {
+      on_progress = info[1].As<Napi::Object>().Get("onProgress");
+    }
+    
+    // Mark the handle closed now so it cannot open new connections; its reference is dropped on the worker
+    bool release = db->open;
+    db->open = false;
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new CloseWorker(deferred, on_progress, release);
+    worker->Queue();
+    
+    return deferred.Promise();
+  }
+
   // function connect(database: Database, database_name: string, autocommit: boolean): Connection
   Napi::Value connect(const Napi::CallbackInfo& info) {
     auto env = info.Env();
-    // Validate database parameter (db is not used but needed for type checking)
-    (void)GetDatabaseFromExternal(env, info[0]);
+    // Validate database parameter; the new connection takes its own engine reference
+    if (!GetDatabaseFromExternal(env, info[0])->open) {
+      throw Napi::Error::New(env, "Database is closed");
+    }
     std::string db_name = info[1].As<Napi::String>().Utf8Value();
     bool autocommit = info[2].As<Napi::Boolean>().Value();
     
@@ -827,20 +3770,22 @@ class SeekdbNodeAddon : public Napi::Addon<SeekdbNodeAddon> {
     auto env = info.Env();
     auto conn = GetConnectionFromExternal(env, info[0]);
     
-    // Manually close the connection before deleting to avoid double-free
+    // Close the connection now and drop its engine reference
     // Set handle to nullptr so destructor won't try to close again
     if (conn && conn->handle) {
       seekdb_connect_close(conn->handle);
       conn->handle = nullptr;
     }
+    if (conn && conn->retained) {
+      conn->retained = false;
+      SeekdbEngineRegistry::Release();
+    }
     
-    // Connection cleanup is handled by destructor
-    delete conn;
-    
+    // The wrapper itself is freed by GC (the external's finalizer)
     return env.Undefined();
   }
   
-  // function execute(connection: Connection, sql: string, params?: any[]): Promise<Result>
+  // function execute(connection: Connection | Pool | Transaction, sql: string, params?: any[], options?: ExecuteOptions): Promise<Result>
   Napi::Value execute(const Napi::CallbackInfo& info) {
     auto env = info.Env();
     
@@ -848,35 +3793,606 @@ class SeekdbNodeAddon : public Napi::Addon<SeekdbNodeAddon> {
       throw Napi::TypeError::New(env, "Expected connection and sql");
     }
     
-    auto conn = GetConnectionFromExternal(env, info[0]);
+    auto target = GetExecuteTargetFromExternal(env, info[0]);
+    std::string sql = info[1].As<Napi::String>().Utf8Value();
+    
+    // Transparently reuse the analysis of previously seen SQL on this connection
+    auto stmt = target.statements->Get(sql);
+    return QueueExecute(info, std::move(target), std::move(stmt), 2);
+  }
+  
+  // function prepare(connection: Connection | Pool, sql: string): Statement
+  Napi::Value prepare(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    if (info.Length() < 2 || !info[1].IsString()) {
+      throw Napi::TypeError::New(env, "Expected connection and sql");
+    }
+    
+    auto target = GetExecuteTargetFromExternal(env, info[0]);
+    if (target.transaction) {
+      // A statement outliving its transaction would keep the pinned connection leased
+      throw Napi::TypeError::New(env, "Statements cannot be prepared on a transaction");
+    }
+    std::string sql = info[1].As<Napi::String>().Utf8Value();
+    
+    auto stmt_info = target.statements->Get(sql);
+    auto stmt = new SeekdbStatement(std::move(target), std::move(stmt_info), info[0]);
+    
+    return CreateExternal<SeekdbStatement>(env, StatementTypeTag, stmt);
+  }
+  
+  // function execute_prepared(statement: Statement, params?: any[], options?: ExecuteOptions): Promise<Result>
+  Napi::Value execute_prepared(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Expected statement");
+    }
+    
+    auto stmt = GetStatementFromExternal(env, info[0]);
+    if (stmt->target.conn && !stmt->target.conn->handle) {
+      throw Napi::Error::New(env, "Connection of this statement is disconnected");
+    }
+    
+    return QueueExecute(info, stmt->target, stmt->info, 1);
+  }
+  
+  // function execute_stream(connection: Connection | Pool | Transaction, sql: string, params?: any[], options?: StreamOptions): Promise<Cursor>
+  Napi::Value execute_stream(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    if (info.Length() < 2) {
+      throw Napi::TypeError::New(env, "Expected connection and sql");
+    }
+    
+    auto target = GetExecuteTargetFromExternal(env, info[0]);
     std::string sql = info[1].As<Napi::String>().Utf8Value();
     
+    auto stmt = target.statements->Get(sql);
+    return QueueExecute(info, std::move(target), std::move(stmt), 2, true);
+  }
+  
+  // function execute_batch(connection: Connection | Pool | Transaction, statements: BatchStatement[], options?: BatchOptions): Promise<Result[]>
+  Napi::Value execute_batch(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    if (info.Length() < 2 || !info[1].IsArray()) {
+      throw Napi::TypeError::New(env, "Expected connection and statements array");
+    }
+    
+    auto target = GetExecuteTargetFromExternal(env, info[0]);
+    auto statements = info[1].As<Napi::Array>();
+    Napi::Value options_value = info.Length() > 2 ? info[2] : env.Undefined();
+    ExecuteOptions options = ParseExecuteOptions(env, options_value);
+    bool transactional = false;
+    if (options_value.IsObject()) {
+      Napi::Value tx = options_value.As<Napi::Object>().Get("transactional");
+      transactional = tx.IsBoolean() && tx.As<Napi::Boolean>().Value();
+    }
+    // Inside a begin() transaction a nested BEGIN would commit it; its owner commits instead
+    transactional = transactional && !target.transaction;
+    
+    std::vector<SeekdbQuery> queries;
+    queries.reserve(statements.Length());
+    for (uint32_t i = 0; i < statements.Length(); i++) {
+      Napi::Value entry = statements.Get(i);
+      if (!entry.IsObject() || !entry.As<Napi::Object>().Get("sql").IsString()) {
+        throw Napi::TypeError::New(env, "Statement " + std::to_string(i) + " must be { sql: string, params?: any[] }");
+      }
+      auto obj = entry.As<Napi::Object>();
+      std::string sql = obj.Get("sql").As<Napi::String>().Utf8Value();
+      queries.emplace_back(target.statements->Get(sql));
+      Napi::Value params = obj.Get("params");
+      if (params.IsArray() && params.As<Napi::Array>().Length() > 0) {
+        queries.back().SetParams(params.As<Napi::Array>());
+      }
+    }
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new BatchWorker(deferred, std::move(target), std::move(queries), options, transactional);
+    Submit(worker);
+    
+    return deferred.Promise();
+  }
+  
+  // function begin(connection: Connection | Pool): Promise<Transaction>
+  Napi::Value begin(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Expected connection or pool");
+    }
+    
+    auto target = GetExecuteTargetFromExternal(env, info[0]);
+    if (target.transaction) {
+      throw Napi::TypeError::New(env, "Transactions cannot be nested");
+    }
+    auto tx = std::make_shared<SeekdbTransaction>(target.pool, target.conn, target.statements, target.stats,
+                                                  info[0]);
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new BeginWorker(deferred, std::move(tx));
+    Submit(worker);
+    
+    return deferred.Promise();
+  }
+  
+  // function commit(transaction: Transaction): Promise<void>
+  Napi::Value commit(const Napi::CallbackInfo& info) {
+    return EndTransaction(info, true);
+  }
+  
+  // function rollback(transaction: Transaction): Promise<void>
+  Napi::Value rollback(const Napi::CallbackInfo& info) {
+    return EndTransaction(info, false);
+  }
+  
+  // function hybrid_search(connection: Connection | Pool | Transaction, table: string, search_parm: string, options?: HybridSearchOptions): Promise<HybridSearchResult>
+  Napi::Value hybrid_search(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    if (info.Length() < 3 || !info[1].IsString() || !info[2].IsString()) {
+      throw Napi::TypeError::New(env, "Expected connection, table and search_parm JSON string");
+    }
+    
+    auto target = GetExecuteTargetFromExternal(env, info[0]);
+    std::string table = info[1].As<Napi::String>().Utf8Value();
+    Napi::Value options_value = info.Length() > 3 ? info[3] : env.Undefined();
+    ExecuteOptions options = ParseExecuteOptions(env, options_value);
+    bool generate_only = false;
+    if (options_value.IsObject()) {
+      Napi::Value value = options_value.As<Napi::Object>().Get("generateOnly");
+      generate_only = value.IsBoolean() && value.As<Napi::Boolean>().Value();
+    }
+    
+    SeekdbQuery set_parm(target.statements->Get("SET @search_parm = ?"));
+    auto params = Napi::Array::New(env, 1);
+    params.Set(0u, info[2]);
+    set_parm.SetParams(params);
+    std::string get_sql = "SELECT DBMS_HYBRID_SEARCH.GET_SQL(" + QuoteStringLiteral(table) +
+                          ", @search_parm) AS query_sql FROM dual";
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new HybridSearchWorker(deferred, std::move(target), std::move(set_parm),
+                                         std::move(get_sql), options, generate_only);
+    Submit(worker);
+    
+    return deferred.Promise();
+  }
+  
+  // function bulk_insert(connection: Connection | Pool | Transaction, table: string, columns: (string | BulkInsertColumn)[], data: (any[] | TypedArray)[], options?: BulkInsertOptions): Promise<number>
+  Napi::Value bulk_insert(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    if (info.Length() < 4 || !info[1].IsString() || !info[2].IsArray() || !info[3].IsArray()) {
+      throw Napi::TypeError::New(env, "Expected connection, table, columns and column data arrays");
+    }
+    
+    auto target = GetExecuteTargetFromExternal(env, info[0]);
+    std::string table = info[1].As<Napi::String>().Utf8Value();
+    auto names = info[2].As<Napi::Array>();
+    auto data = info[3].As<Napi::Array>();
+    if (names.Length() == 0 || names.Length() != data.Length()) {
+      throw Napi::TypeError::New(env, "Expected one data array per column");
+    }
+    
+    size_t chunk_rows = SEEKDB_DEFAULT_BULK_CHUNK_ROWS;
+    bool transactional = false;
+    if (info.Length() > 4 && info[4].IsObject()) {
+      auto obj = info[4].As<Napi::Object>();
+      Napi::Value chunk_size = obj.Get("chunkSize");
+      if (!chunk_size.IsUndefined()) {
+        if (!chunk_size.IsNumber() || chunk_size.As<Napi::Number>().Int64Value() <= 0) {
+          throw Napi::TypeError::New(env, "chunkSize must be a positive number");
+        }
+        chunk_rows = static_cast<size_t>(chunk_size.As<Napi::Number>().Int64Value());
+      }
+      Napi::Value tx = obj.Get("transactional");
+      transactional = tx.IsBoolean() && tx.As<Napi::Boolean>().Value();
+    }
+    transactional = transactional && !target.transaction;  // See execute_batch
+    
+    std::vector<SeekdbBulkColumn> columns(names.Length());
+    for (uint32_t c = 0; c < names.Length(); c++) {
+      Napi::Value name = names.Get(c);
+      if (name.IsObject() && name.As<Napi::Object>().Get("name").IsString()) {
+        auto obj = name.As<Napi::Object>();
+        columns[c].name = obj.Get("name").As<Napi::String>().Utf8Value();
+        Napi::Value binary_id = obj.Get("binaryId");
+        columns[c].binary_id = binary_id.IsBoolean() && binary_id.As<Napi::Boolean>().Value();
+        Napi::Value update = obj.Get("update");
+        columns[c].update = update.IsBoolean() && update.As<Napi::Boolean>().Value();
+      } else if (name.IsString()) {
+        columns[c].name = name.As<Napi::String>().Utf8Value();
+      } else {
+        throw Napi::TypeError::New(env, "Column " + std::to_string(c) + " must be a name or { name, binaryId?, update? }");
+      }
+      LoadBulkColumn(env, data.Get(c), &columns[c]);
+      if (columns[c].RowCount() != columns[0].RowCount()) {
+        throw Napi::TypeError::New(env, "Column " + columns[c].name + " has " +
+                                   std::to_string(columns[c].RowCount()) + " rows, expected " +
+                                   std::to_string(columns[0].RowCount()));
+      }
+    }
+    size_t row_count = columns[0].RowCount();
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new BulkInsertWorker(deferred, std::move(target), std::move(table), std::move(columns),
+                                       row_count, chunk_rows, transactional);
+    Submit(worker);
+    
+    return deferred.Promise();
+  }
+  
+  // function create_pool(database: Database, database_name: string, autocommit: boolean, options?: PoolOptions): Pool
+  Napi::Value create_pool(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    // Validate database parameter; pooled connections take their own engine references
+    if (!GetDatabaseFromExternal(env, info[0])->open) {
+      throw Napi::Error::New(env, "Database is closed");
+    }
+    std::string db_name = info[1].As<Napi::String>().Utf8Value();
+    bool autocommit = info[2].As<Napi::Boolean>().Value();
+    
+    SeekdbPoolOptions options;
+    if (info.Length() > 3 && info[3].IsObject()) {
+      auto obj = info[3].As<Napi::Object>();
+      Napi::Value min_size = obj.Get("min");
+      if (min_size.IsNumber()) {
+        options.min_size = min_size.As<Napi::Number>().Uint32Value();
+      }
+      Napi::Value max_size = obj.Get("max");
+      if (max_size.IsNumber()) {
+        options.max_size = max_size.As<Napi::Number>().Uint32Value();
+      }
+      Napi::Value idle_timeout = obj.Get("idleTimeoutMs");
+      if (idle_timeout.IsNumber()) {
+        options.idle_timeout_ms = static_cast<uint64_t>(std::max<int64_t>(0, idle_timeout.As<Napi::Number>().Int64Value()));
+      }
+      Napi::Value init_sql = obj.Get("initSql");
+      if (init_sql.IsArray()) {
+        auto statements = init_sql.As<Napi::Array>();
+        for (uint32_t i = 0; i < statements.Length(); i++) {
+          options.init_sql.push_back(statements.Get(i).ToString().Utf8Value());
+        }
+      }
+    }
+    if (options.max_size == 0 || options.min_size > options.max_size) {
+      throw Napi::RangeError::New(env, "Pool size must satisfy 0 <= min <= max and max >= 1");
+    }
+    
+    auto pool = std::make_shared<SeekdbConnectionPool>(db_name, autocommit, options);
+    std::string error;
+    if (!pool->Warm(&error)) {
+      throw Napi::Error::New(env, error);
+    }
+    
+    return CreateExternal<SeekdbPoolHandle>(env, PoolTypeTag, new SeekdbPoolHandle(std::move(pool)));
+  }
+  
+  // function pool_stats(pool: Pool): PoolStats
+  Napi::Value pool_stats(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    SeekdbPoolStats stats = GetPoolFromExternal(env, info[0])->pool->Stats();
+    
+    auto obj = Napi::Object::New(env);
+    obj.Set("total", Napi::Number::New(env, stats.total));
+    obj.Set("idle", Napi::Number::New(env, stats.idle));
+    obj.Set("inUse", Napi::Number::New(env, stats.in_use));
+    obj.Set("waiters", Napi::Number::New(env, stats.waiters));
+    obj.Set("created", Napi::Number::New(env, static_cast<double>(stats.created)));
+    obj.Set("acquired", Napi::Number::New(env, static_cast<double>(stats.acquired)));
+    obj.Set("waited", Napi::Number::New(env, static_cast<double>(stats.waited)));
+    obj.Set("totalWaitMs", Napi::Number::New(env, stats.total_wait_ms));
+    obj.Set("maxWaitMs", Napi::Number::New(env, stats.max_wait_ms));
+    return obj;
+  }
+  
+  // function warm_pool(pool: Pool, connections: number): Promise<number>
+  Napi::Value warm_pool(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto pool = GetPoolFromExternal(env, info[0])->pool;
+    if (info.Length() < 2 || !info[1].IsNumber() || info[1].As<Napi::Number>().Int64Value() < 0) {
+      throw Napi::TypeError::New(env, "connections must be a non-negative number");
+    }
+    int64_t connections = info[1].As<Napi::Number>().Int64Value();
+    uint32_t count = static_cast<uint32_t>(std::min<int64_t>(connections, UINT32_MAX));
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new WarmPoolWorker(deferred, std::move(pool), count);
+    Submit(worker);
+    
+    return deferred.Promise();
+  }
+  
+  // function close_pool(pool: Pool): void
+  Napi::Value close_pool(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    GetPoolFromExternal(env, info[0])->pool->Close();
+    return env.Undefined();
+  }
+  
+  // function fetch_next(cursor: Cursor, batchSize?: number): Promise<Result>
+  Napi::Value fetch_next(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Expected cursor");
+    }
+    
+    auto cursor = GetResultFromExternal(env, info[0]);
+    if (cursor->fetching) {
+      throw Napi::Error::New(env, "Cursor is already fetching; await the previous fetch_next()");
+    }
+    
+    int64_t batch_size = cursor->options.batch_size;
+    if (info.Length() > 1 && !info[1].IsUndefined() && !info[1].IsNull()) {
+      if (!info[1].IsNumber() || info[1].As<Napi::Number>().Int64Value() <= 0) {
+        throw Napi::TypeError::New(env, "batchSize must be a positive number");
+      }
+      batch_size = info[1].As<Napi::Number>().Int64Value();
+    }
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new FetchWorker(deferred, info[0], cursor, batch_size);
+    Submit(worker);
+    
+    return deferred.Promise();
+  }
+  
+  // function close_cursor(cursor: Cursor): void
+  Napi::Value close_cursor(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto cursor = GetResultFromExternal(env, info[0]);
+    
+    if (cursor->fetching) {
+      throw Napi::Error::New(env, "Cannot close a cursor while fetch_next() is in flight");
+    }
+    
+    // Free the native result now; the external itself is released by GC
+    cursor->Release();
+    
+    return env.Undefined();
+  }
+  
+  // function stats(connection: Connection | Pool | Transaction, reset?: boolean): QueryStats
+  Napi::Value stats(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    SeekdbQueryStats* stats = GetExecuteTargetFromExternal(env, info[0]).stats;
+    
+    auto histogram = [&env](const SeekdbLatencyHistogram& h) {
+      auto obj = Napi::Object::New(env);
+      obj.Set("count", Napi::Number::New(env, static_cast<double>(h.count)));
+      obj.Set("totalMs", Napi::Number::New(env, h.total_ms));
+      obj.Set("maxMs", Napi::Number::New(env, h.max_ms));
+      obj.Set("p50Ms", Napi::Number::New(env, h.Quantile(0.5)));
+      obj.Set("p95Ms", Napi::Number::New(env, h.Quantile(0.95)));
+      obj.Set("p99Ms", Napi::Number::New(env, h.Quantile(0.99)));
+      auto buckets = Napi::Array::New(env, SEEKDB_STATS_BUCKETS);
+      for (size_t i = 0; i < SEEKDB_STATS_BUCKETS; i++) {
+        buckets.Set(static_cast<uint32_t>(i), Napi::Number::New(env, static_cast<double>(h.buckets[i])));
+      }
+      obj.Set("buckets", buckets);
+      return obj;
+    };
+    auto obj = Napi::Object::New(env);
+    obj.Set("queries", Napi::Number::New(env, static_cast<double>(stats->queries)));
+    obj.Set("errors", Napi::Number::New(env, static_cast<double>(stats->errors)));
+    obj.Set("rows", Napi::Number::New(env, static_cast<double>(stats->rows)));
+    obj.Set("bytes", Napi::Number::New(env, static_cast<double>(stats->bytes)));
+    obj.Set("fallbackReads", Napi::Number::New(env, static_cast<double>(stats->fallback_reads)));
+    obj.Set("queue", histogram(stats->queue));
+    obj.Set("engine", histogram(stats->engine));
+    obj.Set("fetch", histogram(stats->fetch));
+    obj.Set("materialize", histogram(stats->materialize));
+    obj.Set("total", histogram(stats->total));
+    auto bounds = Napi::Array::New(env, SEEKDB_STATS_BUCKETS);
+    for (size_t i = 0; i < SEEKDB_STATS_BUCKETS; i++) {
+      bounds.Set(static_cast<uint32_t>(i), Napi::Number::New(env, SeekdbLatencyHistogram::BucketBoundMs(i)));
+    }
+    obj.Set("bucketBoundsMs", bounds);
+    
+    if (info.Length() > 1 && info[1].ToBoolean().Value()) {
+      *stats = SeekdbQueryStats();
+    }
+    return obj;
+  }
+  
+  // function configure(options: ExecutorOptions): void
+  void configure(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    if (info.Length() < 1 || !info[0].IsObject()) {
+      throw Napi::TypeError::New(env, "Expected options object");
+    }
+    auto obj = info[0].As<Napi::Object>();
+    int64_t threads = SEEKDB_DEFAULT_EXECUTOR_THREADS;
+    int64_t queue_depth = SEEKDB_DEFAULT_EXECUTOR_QUEUE_DEPTH;
+    Napi::Value threads_value = obj.Get("threads");
+    if (!threads_value.IsUndefined()) {
+      threads = threads_value.IsNumber() ? threads_value.As<Napi::Number>().Int64Value() : -1;
+    }
+    Napi::Value queue_depth_value = obj.Get("queueDepth");
+    if (!queue_depth_value.IsUndefined()) {
+      queue_depth = queue_depth_value.IsNumber() ? queue_depth_value.As<Napi::Number>().Int64Value() : 0;
+    }
+    if (threads < 0 || threads > 256) {
+      throw Napi::RangeError::New(env, "threads must be between 0 and 256");
+    }
+    if (queue_depth <= 0 || queue_depth > (1 << 20)) {
+      throw Napi::RangeError::New(env, "queueDepth must be between 1 and 1048576");
+    }
+    
+    std::string error;
+    if (!SeekdbExecutor::Instance().Configure(static_cast<uint32_t>(threads), static_cast<size_t>(queue_depth),
+                                              &error)) {
+      throw Napi::Error::New(env, error);
+    }
+  }
+  
+  // function bm25_encode(texts: string[], options?: Bm25Options): Promise<(string | null)[]>
+  Napi::Value bm25_encode(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    if (info.Length() < 1 || !info[0].IsArray()) {
+      throw Napi::TypeError::New(env, "Expected an array of texts");
+    }
+    auto options = ParseBm25Options(env, info.Length() > 1 ? info[1] : env.Undefined());
+    
+    auto list = info[0].As<Napi::Array>();
+    std::vector<std::string> texts;
+    texts.reserve(list.Length());
+    for (uint32_t i = 0; i < list.Length(); i++) {
+      Napi::Value text = list.Get(i);
+      if (!text.IsString()) {
+        throw Napi::TypeError::New(env, "Text " + std::to_string(i) + " must be a string");
+      }
+      texts.push_back(text.As<Napi::String>().Utf8Value());
+    }
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto worker = new Bm25Worker(deferred, std::move(options), std::move(texts));
+    Submit(worker);
+    
+    return deferred.Promise();
+  }
+  
+  // function vector_find_non_finite(data: Float32Array): number
+  Napi::Value vector_find_non_finite(const Napi::CallbackInfo& info) {
+    auto data = Float32ArrayArg(info, 0, "data");
+    size_t index = SeekdbVectorFindNonFinite(data.Data(), data.ElementLength());
+    return Napi::Number::New(info.Env(), index == data.ElementLength() ? -1.0 : index);
+  }
+  
+  // function vector_normalize(vectors: Float32Array, dimension: number): Float32Array
+  Napi::Value vector_normalize(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto vectors = Float32ArrayArg(info, 0, "vectors");
+    int64_t dimension =
+        info.Length() > 1 && info[1].IsNumber() ? info[1].As<Napi::Number>().Int64Value() : 0;
+    if (dimension <= 0 || vectors.ElementLength() % static_cast<size_t>(dimension) != 0) {
+      throw Napi::RangeError::New(env, "vectors length must be a multiple of dimension");
+    }
+    SeekdbVectorNormalize(vectors.Data(), vectors.ElementLength() / dimension, dimension);
+    return vectors;
+  }
+  
+  // function vector_distances(metric: VectorMetric, query: Float32Array, vectors: Float32Array): Float64Array
+  Napi::Value vector_distances(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    SeekdbVectorMetric metric = ParseVectorMetric(env, info.Length() > 0 ? info[0] : env.Undefined());
+    auto query = Float32ArrayArg(info, 1, "query");
+    auto vectors = Float32ArrayArg(info, 2, "vectors");
+    size_t dimension = query.ElementLength();
+    if (dimension == 0 || vectors.ElementLength() % dimension != 0) {
+      throw Napi::RangeError::New(env, "vectors length must be a multiple of the query length");
+    }
+    size_t count = vectors.ElementLength() / dimension;
+    auto distances = Napi::Float64Array::New(env, count);
+    SeekdbVectorDistances(metric, query.Data(), vectors.Data(), count, dimension, distances.Data());
+    return distances;
+  }
+  
+  // function vector_isa(): string
+  Napi::Value vector_isa(const Napi::CallbackInfo& info) {
+    return Napi::String::New(info.Env(), SeekdbVectorIsa());
+  }
+  
+  // Queue a query worker on the native executor when configure() started it, else on libuv
+  void Submit(SeekdbAsyncWorker* worker) {
+    if (!SeekdbExecutor::Instance().Enabled()) {
+      worker->Submit(nullptr);
+      return;
+    }
+    if (!completions_) {
+      completions_ = SeekdbCompletionChannel::Create(worker->Env());
+    }
+    worker->Submit(completions_);
+  }
+  
+  // Shared body of commit/rollback. The transaction is finished as of this call, so statements
+  // issued after it are rejected instead of running outside the transaction; statements issued
+  // before it still run inside it, COMMIT/ROLLBACK is submitted once they have completed.
+  Napi::Value EndTransaction(const Napi::CallbackInfo& info, bool commit) {
+    auto env = info.Env();
+    auto handle = GetTransactionFromExternal(env, info[0]);
+    std::shared_ptr<SeekdbTransaction> tx = handle->tx;
+    if (tx->finished) {
+      throw Napi::Error::New(env, "Transaction is finished");
+    }
+    if (!tx->pool && !tx->conn->handle) {
+      throw Napi::Error::New(env, "Connection of this transaction is disconnected");
+    }
+    tx->finished = true;
+    
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto submit = [this, deferred, tx, commit]() {
+      Submit(new EndTransactionWorker(deferred, tx, commit));
+    };
+    if (tx->in_flight > 0) {
+      tx->on_drained = submit;
+    } else {
+      submit();
+    }
+    
+    return deferred.Promise();
+  }
+  
+  // Shared tail of execute/execute_prepared: info[first_arg] is params, info[first_arg + 1] is options
+  Napi::Value QueueExecute(const Napi::CallbackInfo& info, SeekdbExecuteTarget target,
+                           std::shared_ptr<const SeekdbStatementInfo> stmt, size_t first_arg,
+                           bool stream = false) {
+    auto env = info.Env();
+    
     // Check if parameters are provided
     Napi::Array params;
     bool has_params = false;
-    if (info.Length() >= 3 && !info[2].IsUndefined() && !info[2].IsNull()) {
-      if (info[2].IsArray()) {
-        params = info[2].As<Napi::Array>();
+    if (info.Length() > first_arg && !info[first_arg].IsUndefined() && !info[first_arg].IsNull()) {
+      if (info[first_arg].IsArray()) {
+        params = info[first_arg].As<Napi::Array>();
         if (params.Length() > 0) {
           has_params = true;
         }
       }
     }
     
+    Napi::Value options_value = info.Length() > first_arg + 1 ? info[first_arg + 1] : env.Undefined();
+    ExecuteOptions options = ParseExecuteOptions(env, options_value);
+    options.stream = stream;
+    Napi::Value signal = options_value.IsObject() ? options_value.As<Napi::Object>().Get("signal") : env.Undefined();
+    if (!signal.IsUndefined() && !signal.IsNull() && !signal.IsObject()) {
+      throw Napi::TypeError::New(env, "signal must be an AbortSignal");
+    }
+    
     // Create promise
     auto deferred = Napi::Promise::Deferred::New(env);
+    if (signal.IsObject() && signal.As<Napi::Object>().Get("aborted").ToBoolean().Value()) {
+      deferred.Reject(CreateAbortError(env));
+      return deferred.Promise();
+    }
+    // SET ob_query_timeout and KILL QUERY act on the whole session, so they need a session no
+    // concurrent worker shares: a pool lease or a pooled transaction
+    const bool exclusive = target.pool || (target.transaction && target.transaction->pool);
+    if ((signal.IsObject() || options.timeout_ms > 0) && !exclusive) {
+      throw Napi::TypeError::New(env, "signal and timeoutMs require a Pool or a pooled Transaction");
+    }
     
     // Create and queue async worker
     ExecuteWorker* worker;
     if (has_params) {
-      worker = new ExecuteWorker(deferred, conn, sql, params);
+      worker = new ExecuteWorker(deferred, std::move(target), std::move(stmt), params, options);
     } else {
-      worker = new ExecuteWorker(deferred, conn, sql);
+      worker = new ExecuteWorker(deferred, std::move(target), std::move(stmt), options);
     }
-    worker->Queue();
+    if (signal.IsObject()) {
+      worker->ArmSignal(signal.As<Napi::Object>());
+    }
+    Submit(worker);
     
     return deferred.Promise();
   }
+  
+  // Executor completions of this env (created on the first executor submission)
+  std::shared_ptr<SeekdbCompletionChannel> completions_;
 };
 
 NODE_API_ADDON(SeekdbNodeAddon)
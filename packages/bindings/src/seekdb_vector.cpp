@@ -0,0 +1,302 @@
+/*
+ * Float32 vector kernels. The SIMD variants are compiled with per-function target attributes, so
+ * the addon needs no global -m flags and still loads on x64 CPUs without AVX2.
+ */
+#include "seekdb_vector.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SEEKDB_VECTOR_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define SEEKDB_VECTOR_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+struct Kernels {
+  const char* isa;
+  float (*dot)(const float* a, const float* b, size_t n);
+  float (*l2_squared)(const float* a, const float* b, size_t n);
+  size_t (*find_non_finite)(const float* data, size_t n);
+};
+
+float DotScalar(const float* a, const float* b, size_t n) {
+  float sum = 0.0f;
+  for (size_t i = 0; i < n; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+float L2SquaredScalar(const float* a, const float* b, size_t n) {
+  float sum = 0.0f;
+  for (size_t i = 0; i < n; i++) {
+    float d = a[i] - b[i];
+    sum += d * d;
+  }
+  return sum;
+}
+
+size_t FindNonFiniteScalar(const float* data, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    if (!std::isfinite(data[i])) {
+      return i;
+    }
+  }
+  return n;
+}
+
+#if SEEKDB_VECTOR_X86
+
+__attribute__((target("avx2,fma"))) float HorizontalSum256(__m256 v) {
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+  return _mm_cvtss_f32(sum);
+}
+
+__attribute__((target("avx2,fma"))) float DotAvx2(const float* a, const float* b, size_t n) {
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+  }
+  for (; i + 8 <= n; i += 8) {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+  }
+  float sum = HorizontalSum256(_mm256_add_ps(acc0, acc1));
+  for (; i < n; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+__attribute__((target("avx2,fma"))) float L2SquaredAvx2(const float* a, const float* b, size_t n) {
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+    __m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8));
+    acc0 = _mm256_fmadd_ps(d0, d0, acc0);
+    acc1 = _mm256_fmadd_ps(d1, d1, acc1);
+  }
+  for (; i + 8 <= n; i += 8) {
+    __m256 d = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+    acc0 = _mm256_fmadd_ps(d, d, acc0);
+  }
+  float sum = HorizontalSum256(_mm256_add_ps(acc0, acc1));
+  for (; i < n; i++) {
+    float d = a[i] - b[i];
+    sum += d * d;
+  }
+  return sum;
+}
+
+__attribute__((target("avx2,fma"))) size_t FindNonFiniteAvx2(const float* data, size_t n) {
+  const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256 max = _mm256_set1_ps(FLT_MAX);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_and_ps(_mm256_loadu_ps(data + i), abs_mask);
+    // Ordered compare: NaN lanes fail like infinite ones
+    __m256 le_max = _mm256_cmp_ps(v, max, _CMP_LE_OQ);
+    unsigned finite = static_cast<unsigned>(_mm256_movemask_ps(le_max));
+    if (finite != 0xff) {
+      return i + __builtin_ctz(~finite & 0xff);
+    }
+  }
+  return i + FindNonFiniteScalar(data + i, n - i);
+}
+
+__attribute__((target("avx512f"))) float HorizontalSum512(__m512 v) {
+  alignas(64) float lanes[16];
+  _mm512_store_ps(lanes, v);
+  float sum = 0.0f;
+  for (float lane : lanes) {
+    sum += lane;
+  }
+  return sum;
+}
+
+__attribute__((target("avx512f"))) float DotAvx512(const float* a, const float* b, size_t n) {
+  __m512 acc0 = _mm512_setzero_ps();
+  __m512 acc1 = _mm512_setzero_ps();
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+    acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), acc1);
+  }
+  for (; i < n; i += 16) {
+    __mmask16 mask = n - i >= 16 ? 0xffff : static_cast<__mmask16>((1u << (n - i)) - 1);
+    acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i),
+                           acc0);
+  }
+  return HorizontalSum512(_mm512_add_ps(acc0, acc1));
+}
+
+__attribute__((target("avx512f"))) float L2SquaredAvx512(const float* a, const float* b,
+                                                         size_t n) {
+  __m512 acc0 = _mm512_setzero_ps();
+  __m512 acc1 = _mm512_setzero_ps();
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m512 d0 = _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i));
+    __m512 d1 = _mm512_sub_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16));
+    acc0 = _mm512_fmadd_ps(d0, d0, acc0);
+    acc1 = _mm512_fmadd_ps(d1, d1, acc1);
+  }
+  for (; i < n; i += 16) {
+    __mmask16 mask = n - i >= 16 ? 0xffff : static_cast<__mmask16>((1u << (n - i)) - 1);
+    __m512 d =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i));
+    acc0 = _mm512_fmadd_ps(d, d, acc0);
+  }
+  return HorizontalSum512(_mm512_add_ps(acc0, acc1));
+}
+
+__attribute__((target("avx512f"))) size_t FindNonFiniteAvx512(const float* data, size_t n) {
+  const __m512 max = _mm512_set1_ps(FLT_MAX);
+  for (size_t i = 0; i < n; i += 16) {
+    __mmask16 mask = n - i >= 16 ? 0xffff : static_cast<__mmask16>((1u << (n - i)) - 1);
+    __m512 v = _mm512_abs_ps(_mm512_maskz_loadu_ps(mask, data + i));
+    // Lanes past n load as 0, which is finite
+    unsigned finite = _mm512_cmp_ps_mask(v, max, _CMP_LE_OQ);
+    if (finite != 0xffff) {
+      return i + __builtin_ctz(~finite & 0xffff);
+    }
+  }
+  return n;
+}
+
+#endif  // SEEKDB_VECTOR_X86
+
+#if SEEKDB_VECTOR_NEON
+
+float DotNeon(const float* a, const float* b, size_t n) {
+  float32x4_t acc0 = vdupq_n_f32(0.0f);
+  float32x4_t acc1 = vdupq_n_f32(0.0f);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    acc0 = vfmaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+    acc1 = vfmaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+  }
+  for (; i + 4 <= n; i += 4) {
+    acc0 = vfmaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+  }
+  float sum = vaddvq_f32(vaddq_f32(acc0, acc1));
+  for (; i < n; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+float L2SquaredNeon(const float* a, const float* b, size_t n) {
+  float32x4_t acc0 = vdupq_n_f32(0.0f);
+  float32x4_t acc1 = vdupq_n_f32(0.0f);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    float32x4_t d0 = vsubq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+    float32x4_t d1 = vsubq_f32(vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    acc0 = vfmaq_f32(acc0, d0, d0);
+    acc1 = vfmaq_f32(acc1, d1, d1);
+  }
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t d = vsubq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+    acc0 = vfmaq_f32(acc0, d, d);
+  }
+  float sum = vaddvq_f32(vaddq_f32(acc0, acc1));
+  for (; i < n; i++) {
+    float d = a[i] - b[i];
+    sum += d * d;
+  }
+  return sum;
+}
+
+size_t FindNonFiniteNeon(const float* data, size_t n) {
+  const float32x4_t max = vdupq_n_f32(FLT_MAX);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    // All-ones lanes for finite values; NaN compares false
+    uint32x4_t finite = vcleq_f32(vabsq_f32(vld1q_f32(data + i)), max);
+    if (vminvq_u32(finite) == 0) {
+      return i + FindNonFiniteScalar(data + i, 4);
+    }
+  }
+  return i + FindNonFiniteScalar(data + i, n - i);
+}
+
+#endif  // SEEKDB_VECTOR_NEON
+
+const Kernels& ActiveKernels() {
+  static const Kernels kernels = [] {
+#if SEEKDB_VECTOR_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return Kernels{"avx512f", DotAvx512, L2SquaredAvx512, FindNonFiniteAvx512};
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+      return Kernels{"avx2", DotAvx2, L2SquaredAvx2, FindNonFiniteAvx2};
+    }
+#elif SEEKDB_VECTOR_NEON
+    return Kernels{"neon", DotNeon, L2SquaredNeon, FindNonFiniteNeon};
+#endif
+    return Kernels{"scalar", DotScalar, L2SquaredScalar, FindNonFiniteScalar};
+  }();
+  return kernels;
+}
+
+}  // namespace
+
+size_t SeekdbVectorFindNonFinite(const float* data, size_t n) {
+  return ActiveKernels().find_non_finite(data, n);
+}
+
+void SeekdbVectorNormalize(float* data, size_t count, size_t dimension) {
+  const Kernels& kernels = ActiveKernels();
+  for (size_t r = 0; r < count; r++) {
+    float* row = data + r * dimension;
+    float norm = std::sqrt(kernels.dot(row, row, dimension));
+    if (norm > 0.0f && std::isfinite(norm)) {
+      for (size_t i = 0; i < dimension; i++) {
+        row[i] /= norm;
+      }
+    }
+  }
+}
+
+void SeekdbVectorDistances(SeekdbVectorMetric metric, const float* query, const float* rows,
+                           size_t count, size_t dimension, double* out) {
+  const Kernels& kernels = ActiveKernels();
+  double query_norm = 0.0;
+  if (metric == SeekdbVectorMetric::kCosine) {
+    query_norm = std::sqrt(static_cast<double>(kernels.dot(query, query, dimension)));
+  }
+  for (size_t r = 0; r < count; r++) {
+    const float* row = rows + r * dimension;
+    switch (metric) {
+      case SeekdbVectorMetric::kL2:
+        out[r] = std::sqrt(static_cast<double>(kernels.l2_squared(query, row, dimension)));
+        break;
+      case SeekdbVectorMetric::kInnerProduct:
+        out[r] = kernels.dot(query, row, dimension);
+        break;
+      case SeekdbVectorMetric::kCosine: {
+        double norms = query_norm * std::sqrt(static_cast<double>(kernels.dot(row, row, dimension)));
+        out[r] = norms > 0.0 ? 1.0 - kernels.dot(query, row, dimension) / norms : NAN;
+        break;
+      }
+    }
+  }
+}
+
+const char* SeekdbVectorIsa() {
+  return ActiveKernels().isa;
+}
@@ -0,0 +1,25 @@
+/*
+ * Float32 vector kernels: finite check, L2 normalization and batched distances. Dispatches at
+ * runtime to AVX-512 or AVX2 on x64 and uses NEON on arm64, with a scalar fallback.
+ */
+#pragma once
+
+#include <cstddef>
+
+// Distance functions of buildVectorQuery: l2_distance, cosine_distance, inner_product
+enum class SeekdbVectorMetric { kL2, kCosine, kInnerProduct };
+
+// Index of the first NaN or infinite element of data[0, n), or n when all are finite
+size_t SeekdbVectorFindNonFinite(const float* data, size_t n);
+
+// Scale each of count rows of dimension floats to unit L2 norm in place; zero rows are left as is
+void SeekdbVectorNormalize(float* data, size_t count, size_t dimension);
+
+// out[i] = distance from query to row i of rows (count rows of dimension floats). cosine is
+// 1 - dot / (|query| |row|), NaN when either norm is zero; l2 is the Euclidean distance and
+// inner_product the plain dot product, as the engine computes them.
+void SeekdbVectorDistances(SeekdbVectorMetric metric, const float* query, const float* rows,
+                           size_t count, size_t dimension, double* out);
+
+// Instruction set the kernels run on: "avx512f", "avx2", "neon" or "scalar"
+const char* SeekdbVectorIsa();
@@ -1,5 +1,5 @@
 import { describe, expect, it } from "vitest";
-import { SeekdbValueError } from "seekdb";
+import { SeekdbValueError, serializeSparseVector } from "seekdb";
 import { Bm25EmbeddingFunction } from "./index";
 
 describe("Bm25EmbeddingFunction", () => {
@@ -80,6 +80,22 @@ describe("Bm25EmbeddingFunction", () => {
     expect(qv).toEqual(dv);
   });
 
+  it("should serialize the same sparse vectors natively and in JS", async () => {
+    const texts = [
+      "Running runners ran; generously generalized relational databases!",
+      "The skies, the dying news and skis at 42_000 feet",
+      "Caresses ponies ties cries kiwis hopping hoping agreed",
+      "Ünïcode text is left to the JS tokenizer: café naïve",
+      "",
+    ];
+    const config = { k: 1.4, b: 0.6, stopwords: ["Ran", "feet"] };
+    const ef = new Bm25EmbeddingFunction(config);
+    const js = new Bm25EmbeddingFunction({ ...config, native: false });
+    const expected = (await js.generate(texts)).map(serializeSparseVector);
+    expect(await js.generateSerialized(texts)).toEqual(expected);
+    expect(await ef.generateSerialized(texts)).toEqual(expected);
+  });
+
   it("should reject invalid constructor config", () => {
     expect(() => new Bm25EmbeddingFunction({ k: 0 })).toThrow(SeekdbValueError);
     expect(() => new Bm25EmbeddingFunction({ b: 1.1 })).toThrow(
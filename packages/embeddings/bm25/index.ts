@@ -4,7 +4,9 @@ import {
   SparseVector,
   registerSparseEmbeddingFunction,
   SeekdbValueError,
+  serializeSparseVector,
 } from "seekdb";
+import { createRequire } from "node:module";
 import { newStemmer } from "snowball-stemmers";
 
 const NAME = "bm25";
@@ -14,6 +16,8 @@ const DEFAULT_B = 0.75;
 const DEFAULT_AVG_DOC_LENGTH = 256.0;
 const DEFAULT_TOKEN_MAX_LENGTH = 40;
 const DEFAULT_MAX_DIMENSION = 500_000;
+/** Texts per native bm25_encode() call; batches are split so chunks run on parallel threads */
+const NATIVE_CHUNK_SIZE = 256;
 
 const DEFAULT_STOPWORDS = [
   "a",
@@ -49,6 +53,40 @@ type SnowballStemmer = {
 
 const ENGLISH_STEMMER: SnowballStemmer = newStemmer("english");
 
+interface NativeBm25 {
+  bm25_encode(
+    texts: string[],
+    options: {
+      k: number;
+      b: number;
+      avgDocLength: number;
+      tokenMaxLength: number;
+      maxDimension: number;
+      stopwords: string[];
+    }
+  ): Promise<(string | null)[]>;
+}
+
+let nativeBm25: NativeBm25 | null | undefined;
+
+/**
+ * The native BM25 kernel of @seekdb/js-bindings, when its addon is installed and already
+ * loadable (never triggers an on-demand download); null otherwise.
+ */
+function loadNativeBm25(): NativeBm25 | null {
+  if (nativeBm25 === undefined) {
+    try {
+      const require = createRequire(import.meta.url);
+      const bindings = require("@seekdb/js-bindings");
+      nativeBm25 =
+        typeof bindings?.bm25_encode === "function" ? bindings : null;
+    } catch {
+      nativeBm25 = null;
+    }
+  }
+  return nativeBm25;
+}
+
 export interface Bm25EmbeddingArgs extends EmbeddingConfig {
   k?: number;
   b?: number;
@@ -57,6 +95,11 @@ export interface Bm25EmbeddingArgs extends EmbeddingConfig {
   /** Max sparse dimension index. Default 500000. */
   maxDimension?: number;
   stopwords?: string[];
+  /**
+   * Encode ingest batches (generateSerialized) with the native kernel of
+   * @seekdb/js-bindings when it is installed. Output is identical. Default true.
+   */
+  native?: boolean;
 }
 
 export interface Bm25EmbeddingConfig extends EmbeddingConfig {
@@ -178,6 +221,8 @@ export class Bm25EmbeddingFunction implements SparseEmbeddingFunction {
   private readonly tokenMaxLength: number;
   private readonly maxDimension: number;
   private readonly customStopwords?: string[];
+  private readonly stopwordList: string[];
+  private readonly native: boolean;
 
   constructor(args: Bm25EmbeddingArgs = {}) {
     const {
@@ -187,6 +232,7 @@ export class Bm25EmbeddingFunction implements SparseEmbeddingFunction {
       tokenMaxLength = DEFAULT_TOKEN_MAX_LENGTH,
       maxDimension = DEFAULT_MAX_DIMENSION,
       stopwords,
+      native = true,
     } = args;
 
     if (!Number.isFinite(k) || k <= 0) {
@@ -215,6 +261,8 @@ export class Bm25EmbeddingFunction implements SparseEmbeddingFunction {
     this.customStopwords = stopwords ? [...stopwords] : undefined;
 
     const stopwordList = this.customStopwords ?? [...DEFAULT_STOPWORDS];
+    this.stopwordList = stopwordList.map((word) => word.toLowerCase());
+    this.native = native;
     this.tokenizer = new Bm25Tokenizer(
       ENGLISH_STEMMER,
       stopwordList,
@@ -261,6 +309,39 @@ export class Bm25EmbeddingFunction implements SparseEmbeddingFunction {
     return this.generate(texts);
   }
 
+  /**
+   * Sparse literals for texts, as serializeSparseVector(generate(texts)). Uses the native
+   * kernel when available; texts it does not handle (non-ASCII) are encoded in JS.
+   */
+  public async generateSerialized(texts: string[]): Promise<string[]> {
+    if (!Array.isArray(texts)) {
+      throw new SeekdbValueError("texts must be an array of strings");
+    }
+    const native = this.native ? loadNativeBm25() : null;
+    if (!native) {
+      return texts.map((text) => serializeSparseVector(this.encode(text)));
+    }
+
+    const options = {
+      k: this.k,
+      b: this.b,
+      avgDocLength: this.avgDocLength,
+      tokenMaxLength: this.tokenMaxLength,
+      maxDimension: this.maxDimension,
+      stopwords: this.stopwordList,
+    };
+    const chunks: Promise<(string | null)[]>[] = [];
+    for (let i = 0; i < texts.length; i += NATIVE_CHUNK_SIZE) {
+      chunks.push(
+        native.bm25_encode(texts.slice(i, i + NATIVE_CHUNK_SIZE), options)
+      );
+    }
+    const literals = (await Promise.all(chunks)).flat();
+    return literals.map(
+      (literal, i) => literal ?? serializeSparseVector(this.encode(texts[i]))
+    );
+  }
+
   public getConfig(): Bm25EmbeddingConfig {
     const config: Bm25EmbeddingConfig = {
       k: this.k,
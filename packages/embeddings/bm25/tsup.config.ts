@@ -4,4 +4,9 @@ import baseConfig from "../../../tsup.config.base";
 export default defineConfig({
   ...baseConfig,
   entry: ["index.ts"],
+  esbuildOptions(options, context) {
+    if (context.format === "cjs") {
+      options.define = { ...options.define, "import.meta.url": "__filename" };
+    }
+  },
 });
@@ -7,7 +7,12 @@ import type {
   Transaction,
 } from "@prisma/driver-adapter-utils";
 import { Debug, DriverAdapterError } from "@prisma/driver-adapter-utils";
-import { inferColumnTypes } from "./conversion.js";
+import {
+  type SeekdbFieldLike,
+  fieldsToColumnTypes,
+  inferColumnTypes,
+  valueToColumnType,
+} from "./conversion.js";
 
 const debug = Debug("prisma:driver-adapter:seekdb");
 const ADAPTER_NAME = "@seekdb/prisma-adapter";
@@ -18,12 +23,47 @@ const EMPTY_RESULT: SqlResultSet = {
   rows: [],
 };
 
-/** Minimal interface for seekdb client used by the adapter (execute only). */
+/** Result of SeekdbClient.executeRows(): array rows with column metadata */
+export interface SeekdbRowArrayResultLike {
+  columns: string[];
+  fields?: SeekdbFieldLike[];
+  rows: unknown[][];
+}
+
+/** Minimal interface for seekdb client used by the adapter. */
 export interface SeekdbClientLike {
   execute(
     sql: string,
     params?: unknown[]
   ): Promise<Record<string, unknown>[] | null>;
+  /**
+   * Array rows plus field types (SeekdbClient.executeRows()). When present,
+   * queryRaw uses it and maps column types once per column from the fields
+   * instead of building and re-reading row objects.
+   */
+  executeRows?(
+    sql: string,
+    params?: unknown[]
+  ): Promise<SeekdbRowArrayResultLike>;
+  /**
+   * Start a transaction (SeekdbClient.beginTransaction()). When omitted the
+   * adapter sends START TRANSACTION / COMMIT / ROLLBACK through execute().
+   */
+  beginTransaction?(): Promise<SeekdbTransactionLike>;
+}
+
+/** Transaction returned by SeekdbClientLike.beginTransaction() */
+export interface SeekdbTransactionLike {
+  execute(
+    sql: string,
+    params?: unknown[]
+  ): Promise<Record<string, unknown>[] | null>;
+  executeRows?(
+    sql: string,
+    params?: unknown[]
+  ): Promise<SeekdbRowArrayResultLike>;
+  commit(): Promise<void>;
+  rollback(): Promise<void>;
 }
 
 function rowsToResultSet(rows: Record<string, unknown>[]): SqlResultSet {
@@ -33,6 +73,16 @@ function rowsToResultSet(rows: Record<string, unknown>[]): SqlResultSet {
   return { columnNames, columnTypes, rows: rowsArray };
 }
 
+function rowArraysToResultSet(result: SeekdbRowArrayResultLike): SqlResultSet {
+  const { columns, fields, rows } = result;
+  if (!columns.length) return EMPTY_RESULT;
+  const columnTypes =
+    fields?.length === columns.length
+      ? fieldsToColumnTypes(fields, rows)
+      : columns.map((_, j) => valueToColumnType(rows[0]?.[j]));
+  return { columnNames: columns, columnTypes, rows };
+}
+
 class SeekdbQueryable implements SqlDriverAdapter {
   readonly provider = "mysql" as const;
   readonly adapterName = ADAPTER_NAME;
@@ -41,6 +91,18 @@ class SeekdbQueryable implements SqlDriverAdapter {
 
   async queryRaw(query: SqlQuery): Promise<SqlResultSet> {
     debug("[queryRaw] %s", query.sql.substring(0, 80));
+    if (this.client.executeRows) {
+      const { sql, args } = query;
+      try {
+        const result = await this.client.executeRows(
+          sql,
+          args?.length ? args : undefined
+        );
+        return rowArraysToResultSet(result);
+      } catch (e) {
+        throw this.wrapError(e);
+      }
+    }
     const rows = await this.performQuery(query);
     if (!rows?.length) return EMPTY_RESULT;
     return rowsToResultSet(rows);
@@ -98,8 +160,22 @@ class SeekdbQueryable implements SqlDriverAdapter {
   async startTransaction(
     _isolationLevel?: IsolationLevel
   ): Promise<Transaction> {
-    await this.client.execute("START TRANSACTION");
     const { client } = this;
+    if (client.beginTransaction) {
+      // Statements of the transaction run on its own (pinned) connection
+      const tx = await client.beginTransaction();
+      const queryable = new SeekdbQueryable(tx);
+      return {
+        provider: this.provider,
+        adapterName: this.adapterName,
+        options: { usePhantomQuery: true },
+        queryRaw: (q) => queryable.queryRaw(q),
+        executeRaw: (q) => queryable.executeRaw(q),
+        commit: () => tx.commit(),
+        rollback: () => tx.rollback(),
+      };
+    }
+    await client.execute("START TRANSACTION");
     return {
       provider: this.provider,
       adapterName: this.adapterName,
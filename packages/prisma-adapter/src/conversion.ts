@@ -27,3 +27,47 @@ export function inferColumnTypes(
     first ? valueToColumnType(first[name]) : ColumnTypeEnum.Text
   );
 }
+
+/** Column metadata of SeekdbClient.executeRows() (seekdb field type codes) */
+export interface SeekdbFieldLike {
+  name: string;
+  type: number | null;
+  length: number;
+  flags: number;
+}
+
+/**
+ * Map each column once from its seekdb field type (TINY=1, SHORT=2, LONG=3, LONGLONG=4,
+ * FLOAT=5, DOUBLE=6, STRING=11, BLOB=12, VECTOR=40/13). TINY is Boolean when its cells
+ * decode as booleans; other or unknown types fall back to the first non-null value.
+ */
+export function fieldsToColumnTypes(
+  fields: SeekdbFieldLike[],
+  rows: unknown[][]
+): ColumnType[] {
+  return fields.map((field, j) => {
+    const sample = () => rows.find((row) => row[j] != null)?.[j];
+    switch (field.type) {
+      case 1:
+        return typeof sample() === "boolean"
+          ? ColumnTypeEnum.Boolean
+          : ColumnTypeEnum.Int32;
+      case 2:
+      case 3:
+        return ColumnTypeEnum.Int32;
+      case 4:
+        return ColumnTypeEnum.Int64;
+      case 5:
+        return ColumnTypeEnum.Float;
+      case 6:
+        return ColumnTypeEnum.Double;
+      case 11:
+      case 12:
+      case 13:
+      case 40:
+        return ColumnTypeEnum.Text;
+      default:
+        return valueToColumnType(sample());
+    }
+  });
+}
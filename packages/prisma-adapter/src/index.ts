@@ -15,4 +15,8 @@
  */
 
 export { PrismaSeekdbAdapterFactory as PrismaSeekdb } from "./adapter.js";
-export type { SeekdbClientLike } from "./adapter.js";
+export type {
+  SeekdbClientLike,
+  SeekdbRowArrayResultLike,
+} from "./adapter.js";
+export type { SeekdbFieldLike } from "./conversion.js";
@@ -1,6 +1,7 @@
 import { describe, it, expect, vi, beforeEach } from "vitest";
 import { PrismaSeekdb } from "../src/index.js";
 import type { SeekdbClientLike } from "../src/adapter.js";
+import { ColumnTypeEnum } from "@prisma/driver-adapter-utils";
 
 describe("PrismaSeekdbAdapterFactory", () => {
   let mockClient: SeekdbClientLike;
@@ -84,6 +85,42 @@ describe("PrismaSeekdbAdapterFactory", () => {
     );
   });
 
+  it("queryRaw uses executeRows and field types when available", async () => {
+    mockClient.executeRows = vi.fn().mockResolvedValue({
+      columns: ["id", "name"],
+      fields: [
+        { name: "id", type: 4, length: 20, flags: 0 },
+        { name: "name", type: 11, length: 255, flags: 0 },
+      ],
+      rows: [
+        [1, "Alice"],
+        [2, "Bob"],
+      ],
+    });
+    const factory = new PrismaSeekdb(mockClient);
+    const adapter = await factory.connect();
+
+    const result = await adapter.queryRaw({
+      sql: "SELECT id, name FROM users WHERE id > ?",
+      args: [0],
+      argTypes: [],
+    });
+
+    expect(result).toEqual({
+      columnNames: ["id", "name"],
+      columnTypes: [ColumnTypeEnum.Int64, ColumnTypeEnum.Text],
+      rows: [
+        [1, "Alice"],
+        [2, "Bob"],
+      ],
+    });
+    expect(mockClient.executeRows).toHaveBeenCalledWith(
+      "SELECT id, name FROM users WHERE id > ?",
+      [0]
+    );
+    expect(mockClient.execute).not.toHaveBeenCalled();
+  });
+
   it("queryRaw passes args to execute", async () => {
     vi.mocked(mockClient.execute).mockResolvedValue([{ id: 1 }] as Record<
       string,
@@ -171,6 +208,30 @@ describe("PrismaSeekdbAdapterFactory", () => {
     expect(mockClient.execute).toHaveBeenCalledWith("ROLLBACK");
   });
 
+  it("startTransaction runs statements on the client's transaction", async () => {
+    const tx = {
+      execute: vi.fn().mockResolvedValue([{ n: 1 }]),
+      commit: vi.fn().mockResolvedValue(undefined),
+      rollback: vi.fn().mockResolvedValue(undefined),
+    };
+    mockClient.beginTransaction = vi.fn().mockResolvedValue(tx);
+    const factory = new PrismaSeekdb(mockClient);
+    const adapter = await factory.connect();
+
+    const transaction = await adapter.startTransaction();
+    const result = await transaction.queryRaw({
+      sql: "SELECT 1 AS n",
+      args: [],
+      argTypes: [],
+    });
+    await transaction.commit();
+
+    expect(result.rows).toEqual([[1]]);
+    expect(tx.execute).toHaveBeenCalledWith("SELECT 1 AS n", undefined);
+    expect(tx.commit).toHaveBeenCalledTimes(1);
+    expect(mockClient.execute).not.toHaveBeenCalled();
+  });
+
   it("dispose does not throw", async () => {
     const factory = new PrismaSeekdb(mockClient);
     const adapter = await factory.connect();
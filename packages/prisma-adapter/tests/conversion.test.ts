@@ -1,5 +1,9 @@
 import { describe, it, expect } from "vitest";
-import { valueToColumnType, inferColumnTypes } from "../src/conversion.js";
+import {
+  valueToColumnType,
+  inferColumnTypes,
+  fieldsToColumnTypes,
+} from "../src/conversion.js";
 import { ColumnTypeEnum } from "@prisma/driver-adapter-utils";
 
 describe("conversion", () => {
@@ -77,4 +81,50 @@ describe("conversion", () => {
       expect(result).toEqual([ColumnTypeEnum.Text, ColumnTypeEnum.Text]);
     });
   });
+
+  describe("fieldsToColumnTypes", () => {
+    const field = (type: number | null) => ({
+      name: "c",
+      type,
+      length: 0,
+      flags: 0,
+    });
+
+    it("maps seekdb field types per column", () => {
+      const result = fieldsToColumnTypes(
+        [2, 4, 5, 6, 11, 40].map(field),
+        [[1, 2, 1.5, 2.5, "a", "[1,2]"]]
+      );
+      expect(result).toEqual([
+        ColumnTypeEnum.Int32,
+        ColumnTypeEnum.Int64,
+        ColumnTypeEnum.Float,
+        ColumnTypeEnum.Double,
+        ColumnTypeEnum.Text,
+        ColumnTypeEnum.Text,
+      ]);
+    });
+
+    it("maps TINY to Boolean when its cells are booleans", () => {
+      const fields = [field(1), field(1)];
+      const rows = [
+        [null, 3],
+        [true, 4],
+      ];
+      expect(fieldsToColumnTypes(fields, rows)).toEqual([
+        ColumnTypeEnum.Boolean,
+        ColumnTypeEnum.Int32,
+      ]);
+    });
+
+    it("infers unknown types from the first non-null value", () => {
+      const rows = [[null], [new Date()]];
+      expect(fieldsToColumnTypes([field(null)], rows)).toEqual([
+        ColumnTypeEnum.DateTime,
+      ]);
+      expect(fieldsToColumnTypes([field(null)], [])).toEqual([
+        ColumnTypeEnum.Text,
+      ]);
+    });
+  });
 });
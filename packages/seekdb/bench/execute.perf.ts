@@ -0,0 +1,136 @@
+/**
+ * execute() read throughput: rows/sec by column type and row width, with the native
+ * queue/engine/fetch/materialize split from client.queryStats().
+ */
+import { describe, test, beforeAll, afterAll } from "vitest";
+import { SeekdbClient } from "../src/client.js";
+import {
+  QUICK,
+  benchDbConfig,
+  peakRssMb,
+  randomDocument,
+  randomVectors,
+  record,
+  seededRandom,
+  timeMs,
+} from "./harness.js";
+
+const SUITE = "execute";
+const ROWS = QUICK ? 2000 : 20000;
+const ITERATIONS = QUICK ? 3 : 10;
+const INSERT_CHUNK = 500;
+
+/** Column type, how many columns of it, and the value generator */
+const CASES: {
+  name: string;
+  type: string;
+  columns: number;
+  value: (random: () => number) => unknown;
+}[] = [
+  {
+    name: "int x1",
+    type: "BIGINT",
+    columns: 1,
+    value: (r) => Math.floor(r() * 1e9),
+  },
+  {
+    name: "int x8",
+    type: "BIGINT",
+    columns: 8,
+    value: (r) => Math.floor(r() * 1e9),
+  },
+  {
+    name: "int x32",
+    type: "BIGINT",
+    columns: 32,
+    value: (r) => Math.floor(r() * 1e9),
+  },
+  { name: "double x8", type: "DOUBLE", columns: 8, value: (r) => r() * 1000 },
+  {
+    name: "varchar(64) x8",
+    type: "VARCHAR(64)",
+    columns: 8,
+    value: (r) => randomDocument(r, 6),
+  },
+  {
+    name: "text 1KB x1",
+    type: "TEXT",
+    columns: 1,
+    value: (r) => randomDocument(r, 140),
+  },
+  {
+    name: "vector(128) x1",
+    type: "VECTOR(128)",
+    columns: 1,
+    value: (r) => JSON.stringify(randomVectors(r, 1, 128)[0]),
+  },
+];
+
+describe(`bench: ${SUITE}`, () => {
+  let client: SeekdbClient;
+
+  beforeAll(async () => {
+    client = new SeekdbClient(benchDbConfig(SUITE));
+  });
+
+  afterAll(async () => {
+    record(SUITE, "suite", "peak_rss", "MB", peakRssMb());
+    await client.close();
+  });
+
+  for (const c of CASES) {
+    test(c.name, async () => {
+      const table = `bench_${c.name.replace(/[^a-z0-9]+/gi, "_")}`;
+      const cols = Array.from({ length: c.columns }, (_, i) => `c${i}`);
+      await client.execute(`DROP TABLE IF EXISTS \`${table}\``);
+      await client.execute(
+        `CREATE TABLE \`${table}\` (id INT PRIMARY KEY, ${cols
+          .map((col) => `${col} ${c.type}`)
+          .join(", ")})`
+      );
+
+      const random = seededRandom(42);
+      const rowSql = `(${["?", ...cols.map(() => "?")].join(", ")})`;
+      for (let start = 0; start < ROWS; start += INSERT_CHUNK) {
+        const count = Math.min(INSERT_CHUNK, ROWS - start);
+        const params: unknown[] = [];
+        for (let i = 0; i < count; i++) {
+          params.push(start + i, ...cols.map(() => c.value(random)));
+        }
+        await client.execute(
+          `INSERT INTO \`${table}\` (id, ${cols.join(", ")}) VALUES ${Array(
+            count
+          )
+            .fill(rowSql)
+            .join(", ")}`,
+          params
+        );
+      }
+
+      const sql = `SELECT ${cols.join(", ")} FROM \`${table}\``;
+      await client.execute(sql); // Warm up
+      client.queryStats(true);
+      let totalMs = 0;
+      for (let i = 0; i < ITERATIONS; i++) {
+        totalMs += await timeMs(() => client.execute(sql));
+      }
+      const stats = client.queryStats()!;
+
+      const seconds = totalMs / 1000;
+      const rows = ROWS * ITERATIONS;
+      record(SUITE, c.name, "rows_per_sec", "rows/s", rows / seconds);
+      record(
+        SUITE,
+        c.name,
+        "cells_per_sec",
+        "cells/s",
+        (rows * c.columns) / seconds
+      );
+      record(SUITE, c.name, "engine_p50", "ms", stats.engine.p50Ms);
+      record(SUITE, c.name, "fetch_p50", "ms", stats.fetch.p50Ms);
+      record(SUITE, c.name, "materialize_p50", "ms", stats.materialize.p50Ms);
+
+      await client.execute(`DROP TABLE IF EXISTS \`${table}\``);
+    });
+  }
+});
@@ -0,0 +1,181 @@
+/**
+ * Benchmark harness shared by the *.perf.ts suites (run with `pnpm bench`).
+ *
+ * Every measurement is appended as one JSON line to bench/results/<run>.jsonl.
+ * The record shape is versioned by `schema` and only ever gains fields, so results
+ * from different SDK versions can be diffed to catch regressions before upgrading.
+ */
+import * as fs from "node:fs";
+import * as os from "node:os";
+import * as path from "node:path";
+import { fileURLToPath } from "node:url";
+
+const BENCH_DIR = path.dirname(fileURLToPath(import.meta.url));
+const RESULTS_DIR = path.join(BENCH_DIR, "results");
+const DB_DIR = path.join(BENCH_DIR, "seekdb.db");
+
+/** SEEKDB_BENCH_QUICK=1 runs reduced sizes (smoke run, e.g. in CI) */
+export const QUICK =
+  process.env.SEEKDB_BENCH_QUICK === "1" ||
+  process.env.SEEKDB_BENCH_QUICK === "true";
+
+/** Run id shared by all suites of one `pnpm bench` (set in vitest.bench.config.ts) */
+const RUN = process.env.SEEKDB_BENCH_RUN ?? new Date().toISOString();
+
+const PACKAGE_VERSION: string = JSON.parse(
+  fs.readFileSync(path.join(BENCH_DIR, "..", "package.json"), "utf8")
+).version;
+
+export interface BenchRecord {
+  schema: 1;
+  run: string;
+  suite: string;
+  case: string;
+  metric: string;
+  unit: string;
+  value: number;
+  version: string;
+  node: string;
+  platform: string;
+  arch: string;
+  cpus: number;
+  quick: boolean;
+}
+
+/** Append one measurement to the run's result file and echo it */
+export function record(
+  suite: string,
+  name: string,
+  metric: string,
+  unit: string,
+  value: number
+): void {
+  const entry: BenchRecord = {
+    schema: 1,
+    run: RUN,
+    suite,
+    case: name,
+    metric,
+    unit,
+    value: Number(value.toFixed(3)),
+    version: PACKAGE_VERSION,
+    node: process.version,
+    platform: process.platform,
+    arch: process.arch,
+    cpus: os.cpus().length,
+    quick: QUICK,
+  };
+  fs.mkdirSync(RESULTS_DIR, { recursive: true });
+  const file = path.join(RESULTS_DIR, `${RUN.replace(/[:.]/g, "-")}.jsonl`);
+  fs.appendFileSync(file, JSON.stringify(entry) + "\n");
+  console.log(
+    `[bench] ${suite} | ${name} | ${metric} = ${entry.value} ${unit}`
+  );
+}
+
+/** Peak resident set size of the process so far, in MB */
+export function peakRssMb(): number {
+  return process.resourceUsage().maxRSS / 1024;
+}
+
+/** Wall time of fn in ms */
+export async function timeMs(fn: () => Promise<unknown>): Promise<number> {
+  const start = performance.now();
+  await fn();
+  return performance.now() - start;
+}
+
+/** Value at quantile q (0-1) of ascending samples */
+export function percentile(sorted: number[], q: number): number {
+  if (sorted.length === 0) return 0;
+  const index = Math.min(
+    sorted.length - 1,
+    Math.max(0, Math.ceil(q * sorted.length) - 1)
+  );
+  return sorted[index];
+}
+
+/**
+ * Run fn `total` times with at most `concurrency` calls in flight.
+ * Returns the per-call latencies (ms, ascending) and the wall time of the whole run.
+ */
+export async function runConcurrent(
+  concurrency: number,
+  total: number,
+  fn: (i: number) => Promise<unknown>
+): Promise<{ latencies: number[]; wallMs: number }> {
+  const latencies: number[] = [];
+  let next = 0;
+  const start = performance.now();
+  await Promise.all(
+    Array.from({ length: concurrency }, async () => {
+      while (next < total) {
+        const i = next++;
+        latencies.push(await timeMs(() => fn(i)));
+      }
+    })
+  );
+  const wallMs = performance.now() - start;
+  latencies.sort((a, b) => a - b);
+  return { latencies, wallMs };
+}
+
+/** Embedded client config for a suite; its database directory is recreated */
+export function benchDbConfig(suite: string): {
+  path: string;
+  database: string;
+} {
+  const dir = path.join(DB_DIR, suite);
+  fs.rmSync(dir, { recursive: true, force: true });
+  return { path: dir, database: "test" };
+}
+
+/** Deterministic pseudo-random generator (mulberry32) so every run ingests the same data */
+export function seededRandom(seed: number): () => number {
+  let state = seed >>> 0;
+  return () => {
+    state = (state + 0x6d2b79f5) >>> 0;
+    let t = state;
+    t = Math.imul(t ^ (t >>> 15), t | 1);
+    t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+    return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+  };
+}
+
+/** count random vectors of dim floats */
+export function randomVectors(
+  random: () => number,
+  count: number,
+  dim: number
+): number[][] {
+  return Array.from({ length: count }, () =>
+    Array.from({ length: dim }, () => random() * 2 - 1)
+  );
+}
+
+const WORDS = [
+  "vector",
+  "search",
+  "hybrid",
+  "engine",
+  "seekdb",
+  "index",
+  "query",
+  "document",
+  "embedding",
+  "latency",
+  "python",
+  "machine",
+  "learning",
+  "database",
+  "storage",
+  "native",
+];
+
+/** Pseudo-random document text of about `words` words */
+export function randomDocument(random: () => number, words: number): string {
+  return Array.from(
+    { length: words },
+    () => WORDS[Math.floor(random() * WORDS.length)]
+  ).join(" ");
+}
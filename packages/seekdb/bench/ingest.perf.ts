@@ -0,0 +1,61 @@
+/**
+ * Ingest throughput of collection.add(): docs/sec for 1k, 10k and 100k document batches.
+ */
+import { describe, test, beforeAll, afterAll } from "vitest";
+import { SeekdbClient } from "../src/client.js";
+import {
+  QUICK,
+  benchDbConfig,
+  peakRssMb,
+  randomDocument,
+  randomVectors,
+  record,
+  seededRandom,
+  timeMs,
+} from "./harness.js";
+
+const SUITE = "ingest";
+const DIMENSION = 128;
+const BATCHES = QUICK ? [1000, 10000] : [1000, 10000, 100000];
+
+describe(`bench: ${SUITE}`, () => {
+  let client: SeekdbClient;
+
+  beforeAll(async () => {
+    client = new SeekdbClient(benchDbConfig(SUITE));
+  });
+
+  afterAll(async () => {
+    record(SUITE, "suite", "peak_rss", "MB", peakRssMb());
+    await client.close();
+  });
+
+  for (const size of BATCHES) {
+    test(`add ${size} docs`, async () => {
+      const name = `bench_ingest_${size}`;
+      const collection = await client.createCollection({
+        name,
+        configuration: { dimension: DIMENSION, distance: "cosine" },
+        embeddingFunction: null,
+      });
+
+      const random = seededRandom(size);
+      const ids = Array.from({ length: size }, (_, i) => `doc_${i}`);
+      const embeddings = randomVectors(random, size, DIMENSION);
+      const documents = ids.map(() => randomDocument(random, 30));
+      const metadatas = ids.map((_, i) => ({
+        shard: i % 16,
+        tag: `t${i % 5}`,
+      }));
+
+      const ms = await timeMs(() =>
+        collection.add({ ids, embeddings, documents, metadatas })
+      );
+      const label = `add ${size}`;
+      record(SUITE, label, "docs_per_sec", "docs/s", size / (ms / 1000));
+      record(SUITE, label, "wall", "ms", ms);
+
+      await client.deleteCollection(name);
+    });
+  }
+});
@@ -0,0 +1,91 @@
+/**
+ * Read latency of collection.query() (KNN) and collection.hybridSearch(): p50/p99 and
+ * queries/sec at 1, 8 and 64 requests in flight.
+ */
+import { describe, test, beforeAll, afterAll } from "vitest";
+import { SeekdbClient } from "../src/client.js";
+import type { Collection } from "../src/collection.js";
+import {
+  QUICK,
+  benchDbConfig,
+  peakRssMb,
+  percentile,
+  randomDocument,
+  randomVectors,
+  record,
+  runConcurrent,
+  seededRandom,
+} from "./harness.js";
+
+const SUITE = "knn";
+const DIMENSION = 128;
+const DOCS = QUICK ? 2000 : 20000;
+const REQUESTS = QUICK ? 64 : 512;
+const CONCURRENCY = [1, 8, 64];
+const N_RESULTS = 10;
+
+describe(`bench: ${SUITE}`, () => {
+  let client: SeekdbClient;
+  let collection: Collection;
+  let queries: number[][];
+
+  beforeAll(async () => {
+    // Concurrent reads need more than one connection
+    client = new SeekdbClient({ ...benchDbConfig(SUITE), pool: { max: 8 } });
+    collection = await client.createCollection({
+      name: "bench_knn",
+      configuration: { dimension: DIMENSION, distance: "cosine" },
+      embeddingFunction: null,
+    });
+    const random = seededRandom(7);
+    const ids = Array.from({ length: DOCS }, (_, i) => `doc_${i}`);
+    await collection.add({
+      ids,
+      embeddings: randomVectors(random, DOCS, DIMENSION),
+      documents: ids.map(() => randomDocument(random, 30)),
+      metadatas: ids.map((_, i) => ({ shard: i % 16 })),
+    });
+    queries = randomVectors(random, REQUESTS, DIMENSION);
+  }, 600000);
+
+  afterAll(async () => {
+    record(SUITE, "suite", "peak_rss", "MB", peakRssMb());
+    await client.close();
+  });
+
+  const report = (
+    name: string,
+    run: { latencies: number[]; wallMs: number }
+  ) => {
+    record(SUITE, name, "p50", "ms", percentile(run.latencies, 0.5));
+    record(SUITE, name, "p99", "ms", percentile(run.latencies, 0.99));
+    const qps = run.latencies.length / (run.wallMs / 1000);
+    record(SUITE, name, "qps", "queries/s", qps);
+  };
+
+  for (const concurrency of CONCURRENCY) {
+    test(`query() x${concurrency}`, async () => {
+      const query = (i: number) =>
+        collection.query({ queryEmbeddings: queries[i], nResults: N_RESULTS });
+      await query(0);
+      const run = await runConcurrent(concurrency, REQUESTS, query);
+      report(`query c=${concurrency}`, run);
+    });
+
+    test(`hybridSearch() x${concurrency}`, async () => {
+      const search = (i: number) =>
+        collection.hybridSearch({
+          query: {
+            whereDocument: { $contains: "vector" },
+            nResults: N_RESULTS,
+          },
+          knn: { queryEmbeddings: [queries[i]], nResults: N_RESULTS },
+          rank: { rrf: {} },
+          nResults: N_RESULTS,
+        });
+      await search(0);
+      const run = await runConcurrent(concurrency, REQUESTS, search);
+      report(`hybridSearch c=${concurrency}`, run);
+    });
+  }
+});
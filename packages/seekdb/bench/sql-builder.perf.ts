@@ -0,0 +1,48 @@
+/**
+ * SQL construction cost of big add() batches (no database): SQLBuilder.buildInsert and
+ * the columnar SQLBuilder.buildBulkInsert used by the embedded bulk path.
+ */
+import { describe, test } from "vitest";
+import { SQLBuilder } from "../src/sql-builder.js";
+import {
+  QUICK,
+  randomDocument,
+  randomVectors,
+  record,
+  seededRandom,
+  timeMs,
+} from "./harness.js";
+
+const SUITE = "sql-builder";
+const DIMENSION = 384;
+const BATCHES = QUICK ? [1000] : [1000, 10000];
+const CTX = { name: "bench", collectionId: undefined } as const;
+
+describe(`bench: ${SUITE}`, () => {
+  for (const size of BATCHES) {
+    const random = seededRandom(size);
+    const ids = Array.from({ length: size }, (_, i) => `doc_${i}`);
+    const data = {
+      ids,
+      embeddings: randomVectors(random, size, DIMENSION),
+      documents: ids.map(() => randomDocument(random, 30)),
+      metadatas: ids.map((_, i) => ({ shard: i % 16 })),
+    };
+
+    test(`buildInsert ${size}`, async () => {
+      SQLBuilder.buildInsert(CTX, data);
+      const ms = await timeMs(async () => SQLBuilder.buildInsert(CTX, data));
+      const rate = size / (ms / 1000);
+      record(SUITE, `buildInsert ${size}`, "rows_per_sec", "rows/s", rate);
+    });
+
+    test(`buildBulkInsert ${size}`, async () => {
+      SQLBuilder.buildBulkInsert(CTX, data);
+      const ms = await timeMs(async () =>
+        SQLBuilder.buildBulkInsert(CTX, data)
+      );
+      const rate = size / (ms / 1000);
+      record(SUITE, `buildBulkInsert ${size}`, "rows_per_sec", "rows/s", rate);
+    });
+  }
+});
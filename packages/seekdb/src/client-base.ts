@@ -18,6 +18,9 @@ import {
   resolveEmbeddingFunction,
   CollectionNames,
   CollectionFieldNames,
+  executeBatch,
+  executeRows,
+  beginTransaction,
 } from "./utils.js";
 import { SeekdbValueError, InvalidCollectionError } from "./errors.js";
 import { getEmbeddingFunction } from "./embedding-function.js";
@@ -34,9 +37,41 @@ import type {
   DistanceMetric,
   Metadata,
   CollectionMetadata,
+  ExecuteStreamOptions,
+  InternalExecuteOptions,
+  BatchStatement,
+  ExecuteBatchOptions,
+  SeekdbTransaction,
+  WarmupOptions,
+  RowArrayResult,
 } from "./types.js";
 import { FulltextIndexConfig, Schema, VectorIndexConfig } from "./schema.js";
 
+/** Collection metadata as getCollection() reads it, before the embedding function is resolved */
+interface CollectionDescriptor {
+  collectionId?: string;
+  schema: Schema;
+  embeddingFunctionConfig?: CollectionMetadata["settings"]["embeddingFunction"];
+}
+
+function copyWithVectorIndex(schema: Schema): Schema {
+  const { fulltextIndex, vectorIndex, sparseVectorIndex } = schema;
+  return new Schema({
+    fulltextIndex,
+    vectorIndex:
+      vectorIndex &&
+      Object.assign(Object.create(VectorIndexConfig.prototype), vectorIndex),
+    sparseVectorIndex,
+  });
+}
+
+interface CollectionCacheEntry {
+  descriptor: CollectionDescriptor;
+  /** getCollection() result without an embeddingFunction override */
+  collection?: Collection;
+  expiresAt: number;
+}
+
 /**
  * Base class for seekdb clients
  * Provides common collection management functionality (v1 + v2 collections).
@@ -47,6 +82,11 @@ export abstract class BaseSeekdbClient {
   protected _adminInternal?: IInternalClient;
   /** Set by SeekdbClient facade so Collection can reference it (e.g. for fork). */
   protected _facade?: unknown;
+  /** Milliseconds getCollection() results are reused for (0: no cache) */
+  protected _collectionCacheTtl = 0;
+  private _collectionCache = new Map<string, CollectionCacheEntry>();
+  // Bumped on invalidation so loads that started before it are not cached
+  private _collectionCacheEpoch = 0;
 
   setFacade(facade: unknown): void {
     this._facade = facade;
@@ -65,12 +105,118 @@ export abstract class BaseSeekdbClient {
   /**
    * Execute raw SQL (current database / session).
    * Supported in both embedded and server mode.
+   * options.signal / options.timeoutMs bound how long the statement may run (embedded mode
+   * needs the pool option for them).
    */
   async execute(
     sql: string,
-    params?: unknown[]
+    params?: unknown[],
+    options?: InternalExecuteOptions
   ): Promise<import("mysql2/promise").RowDataPacket[] | null> {
-    return this._internal.execute(sql, params);
+    return this._internal.execute(sql, params, options);
+  }
+
+  /**
+   * Execute raw SQL and return rows as arrays in column order, with column metadata.
+   * Embedded mode builds the arrays natively and reports each column's field type
+   * (fields), so typed consumers such as ORM adapters map types once per column.
+   */
+  async executeRows(
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowArrayResult> {
+    return executeRows(this._internal, sql, params, options);
+  }
+
+  /**
+   * Execute raw SQL and iterate the rows in batches of options.batchSize.
+   * Embedded mode reads through a native cursor, so memory is bounded by the batch size;
+   * server mode fetches the full result and yields it in batches.
+   */
+  async *executeStream(
+    sql: string,
+    params?: unknown[],
+    options?: ExecuteStreamOptions
+  ): AsyncGenerator<import("mysql2/promise").RowDataPacket[]> {
+    if (this._internal.executeStream) {
+      yield* this._internal.executeStream(sql, params, options);
+      return;
+    }
+    const rows = (await this._internal.execute(sql, params, options)) ?? [];
+    const batchSize = options?.batchSize ?? 1000;
+    for (let i = 0; i < rows.length; i += batchSize) {
+      yield rows.slice(i, i + batchSize);
+    }
+  }
+
+  /**
+   * Execute several statements in order and return one result per statement.
+   * Embedded mode runs the whole list in a single native call; with
+   * options.transactional the batch is wrapped in BEGIN/COMMIT and rolled back on failure.
+   */
+  async executeBatch(
+    statements: BatchStatement[],
+    options?: ExecuteBatchOptions
+  ): Promise<(import("mysql2/promise").RowDataPacket[] | null)[]> {
+    return executeBatch(this._internal, statements, options);
+  }
+
+  /**
+   * Pay cold-start costs before serving traffic: load the native addon (embedded), connect
+   * (filling an embedded pool), then resolve each named collection and read it once, so its
+   * metadata, statement analysis and table are loaded; with preloadIndexes (default) a
+   * vector query also loads its HNSW index. Resolves once warm, e.g. for a readiness probe.
+   */
+  async warmup(options: WarmupOptions = {}): Promise<void> {
+    const { collections = [], preloadIndexes = true, connections } = options;
+    if (this._internal.warmup) await this._internal.warmup(connections);
+    else await this._internal.execute("SELECT 1");
+
+    await Promise.all(
+      collections.map(async (name) => {
+        const collection = await this.getCollection({ name });
+        await collection.get({ limit: 1, include: [] });
+        const { dimension } = collection;
+        if (preloadIndexes && dimension > 0) {
+          // Any non-zero vector works for every metric
+          const probe = new Array<number>(dimension).fill(
+            1 / Math.sqrt(dimension)
+          );
+          await collection.query({
+            queryEmbeddings: probe,
+            nResults: 1,
+            include: [],
+          });
+        }
+      })
+    );
+  }
+
+  /**
+   * Start an explicit transaction for raw SQL. Embedded pools pin one connection
+   * to it until commit() or rollback(); with a single connection (and in server
+   * mode) other statements of this client run inside it meanwhile.
+   */
+  async beginTransaction(): Promise<SeekdbTransaction> {
+    return beginTransaction(this._internal);
+  }
+
+  /**
+   * Run fn in a transaction: committed when fn resolves, rolled back when it throws.
+   * @returns What fn resolved with
+   */
+  async transaction<T>(fn: (tx: SeekdbTransaction) => Promise<T>): Promise<T> {
+    const tx = await this.beginTransaction();
+    let result: T;
+    try {
+      result = await fn(tx);
+    } catch (error) {
+      await tx.rollback().catch(() => undefined);
+      throw error;
+    }
+    await tx.commit();
+    return result;
   }
 
   // ==================== Collection Management ====================
@@ -186,6 +332,7 @@ export abstract class BaseSeekdbClient {
       throw error;
     }
 
+    this.invalidateCollectionCache(name);
     return new Collection({
       name,
       schema: schemaResolved,
@@ -195,6 +342,26 @@ export abstract class BaseSeekdbClient {
     });
   }
 
+  /**
+   * Drop cached getCollection() results for name, or all of them. Needed only
+   * for changes made outside this client, which otherwise show up once the
+   * entries expire (see collectionCacheTtl).
+   */
+  invalidateCollectionCache(name?: string): void {
+    this._collectionCacheEpoch++;
+    if (name === undefined) this._collectionCache.clear();
+    else this._collectionCache.delete(name);
+  }
+
+  private cachedCollection(name: string): CollectionCacheEntry | undefined {
+    const entry = this._collectionCache.get(name);
+    if (entry && entry.expiresAt <= Date.now()) {
+      this._collectionCache.delete(name);
+      return undefined;
+    }
+    return entry;
+  }
+
   /**
    * Extract metadata from v1 table COMMENT (JSON string).
    */
@@ -224,6 +391,67 @@ export abstract class BaseSeekdbClient {
   async getCollection(options: GetCollectionOptions): Promise<Collection> {
     const { name, embeddingFunction: customEmbeddingFunction } = options;
 
+    const cached =
+      this._collectionCacheTtl > 0 ? this.cachedCollection(name) : undefined;
+    if (cached?.collection && customEmbeddingFunction === undefined) {
+      return cached.collection;
+    }
+    const epoch = this._collectionCacheEpoch;
+    const descriptor =
+      cached?.descriptor ?? (await this.loadCollectionDescriptor(name));
+    const { collectionId, embeddingFunctionConfig } = descriptor;
+
+    // The embedding function is set on the vector index below, so a descriptor
+    // that may be cached gets its own copy
+    const schemaResolved =
+      this._collectionCacheTtl > 0
+        ? copyWithVectorIndex(descriptor.schema)
+        : descriptor.schema;
+
+    // Resolve embedding function with priority
+    if (customEmbeddingFunction !== undefined) {
+      // customEmbeddingFunction overrides everything
+      if (schemaResolved.vectorIndex) {
+        schemaResolved.vectorIndex.embeddingFunction =
+          customEmbeddingFunction === null ? null : customEmbeddingFunction;
+      }
+    } else if (!schemaResolved.vectorIndex?.embeddingFunction) {
+      //  no embedding function in schema, try to get default
+      // Note: schema.vectorIndex.embeddingFunction is not undefined (already from fromJSON or schema), skip
+      const ef = await resolveEmbeddingFunction(
+        embeddingFunctionConfig,
+        undefined
+      );
+      if (schemaResolved.vectorIndex) {
+        schemaResolved.vectorIndex.embeddingFunction = ef;
+      }
+    }
+
+    const collection = new Collection({
+      name,
+      schema: schemaResolved,
+      internalClient: this._internal,
+      client: this._facade as any,
+      collectionId,
+    });
+
+    if (this._collectionCacheTtl > 0 && epoch === this._collectionCacheEpoch) {
+      const entry: CollectionCacheEntry = cached ?? {
+        descriptor,
+        expiresAt: Date.now() + this._collectionCacheTtl,
+      };
+      if (customEmbeddingFunction === undefined) entry.collection = collection;
+      this._collectionCache.set(name, entry);
+    }
+    return collection;
+  }
+
+  /**
+   * Read a collection's metadata (v2) or table definition (v1).
+   */
+  private async loadCollectionDescriptor(
+    name: string
+  ): Promise<CollectionDescriptor> {
     // Variables to store collection info
     let collectionId: string | undefined;
 
@@ -342,32 +570,7 @@ export abstract class BaseSeekdbClient {
       schemaResolved = Schema.fromLegacy(configurationMeta, undefined);
     }
 
-    // Resolve embedding function with priority
-    if (customEmbeddingFunction !== undefined) {
-      // customEmbeddingFunction overrides everything
-      if (schemaResolved.vectorIndex) {
-        schemaResolved.vectorIndex.embeddingFunction =
-          customEmbeddingFunction === null ? null : customEmbeddingFunction;
-      }
-    } else if (!schemaResolved.vectorIndex?.embeddingFunction) {
-      //  no embedding function in schema, try to get default
-      // Note: schema.vectorIndex.embeddingFunction is not undefined (already from fromJSON or schema), skip
-      const ef = await resolveEmbeddingFunction(
-        embeddingFunctionConfig,
-        undefined
-      );
-      if (schemaResolved.vectorIndex) {
-        schemaResolved.vectorIndex.embeddingFunction = ef;
-      }
-    }
-
-    return new Collection({
-      name,
-      schema: schemaResolved,
-      internalClient: this._internal,
-      client: this._facade as any,
-      collectionId,
-    });
+    return { collectionId, schema: schemaResolved, embeddingFunctionConfig };
   }
 
   /**
@@ -438,13 +641,17 @@ export abstract class BaseSeekdbClient {
 
     const metadata = await getCollectionMetadata(this._internal, name);
 
-    if (metadata) {
-      const sql = SQLBuilder.buildDropTable(name, metadata.collectionId);
-      await this._internal.execute(sql);
-      await deleteCollectionMetadata(this._internal, name);
-    } else {
-      const sql = SQLBuilder.buildDropTable(name);
-      await this._internal.execute(sql);
+    try {
+      if (metadata) {
+        const sql = SQLBuilder.buildDropTable(name, metadata.collectionId);
+        await this._internal.execute(sql);
+        await deleteCollectionMetadata(this._internal, name);
+      } else {
+        const sql = SQLBuilder.buildDropTable(name);
+        await this._internal.execute(sql);
+      }
+    } finally {
+      this.invalidateCollectionCache(name);
     }
   }
 
@@ -453,6 +660,9 @@ export abstract class BaseSeekdbClient {
    */
   async hasCollection(name: string): Promise<boolean> {
     if (!name || typeof name !== "string") return false;
+    if (this._collectionCacheTtl > 0 && this.cachedCollection(name)) {
+      return true;
+    }
 
     const metadata = await getCollectionMetadata(this._internal, name);
     if (metadata) return true;
@@ -6,7 +6,11 @@
 import { InternalEmbeddedClient } from "./internal-client-embedded.js";
 import { BaseSeekdbClient } from "./client-base.js";
 import { DEFAULT_DATABASE, ADMIN_DATABASE } from "./utils.js";
-import type { SeekdbClientArgs } from "./types.js";
+import type {
+  SeekdbClientArgs,
+  EmbeddedPoolStats,
+  EmbeddedQueryStats,
+} from "./types.js";
 import * as path from "node:path";
 
 /**
@@ -28,9 +32,15 @@ export class SeekdbEmbeddedClient extends BaseSeekdbClient {
     }
     this._path = path.resolve(args.path);
     this._database = args.database ?? DEFAULT_DATABASE;
+    this._collectionCacheTtl = args.collectionCacheTtl ?? 0;
     this._internal = new InternalEmbeddedClient({
       path: this._path,
       database: this._database,
+      pool: args.pool,
+      executor: args.executor,
+      hybridSearchCache: args.hybridSearchCache,
+      groupCommit: args.groupCommit,
+      maxResultBytes: args.maxResultBytes,
     });
     this._adminInternal = new InternalEmbeddedClient({
       path: this._path,
@@ -45,10 +55,35 @@ export class SeekdbEmbeddedClient extends BaseSeekdbClient {
     return this._internal.isConnected();
   }
 
+  /**
+   * Connection pool statistics (in use, idle, waiters, wait time); null unless created with `pool`
+   */
+  poolStats(): EmbeddedPoolStats | null {
+    return this._internal.poolStats();
+  }
+
+  /**
+   * Cumulative execute() statistics (queue, engine, fetch and materialize latency histograms);
+   * null until the first query. Pass reset to clear them after reading.
+   */
+  queryStats(reset?: boolean): EmbeddedQueryStats | null {
+    return this._internal.queryStats(reset);
+  }
+
   /**
    * Close connection
    */
   async close(): Promise<void> {
     await this._internal.close();
   }
+
+  /**
+   * Disconnect and release the embedded database without blocking the event loop.
+   * close() keeps the engine running; call this on graceful shutdown. The engine
+   * closes once no other client (or worker thread) in the process still uses it.
+   */
+  async shutdown(): Promise<void> {
+    await this._internal.shutdown();
+    await (this._adminInternal as InternalEmbeddedClient | undefined)?.shutdown();
+  }
 }
@@ -23,6 +23,7 @@ export class SeekdbServerClient extends BaseSeekdbClient {
       );
     }
     this._database = args.database ?? DEFAULT_DATABASE;
+    this._collectionCacheTtl = args.collectionCacheTtl ?? 0;
     this._internal = new InternalClient(args);
   }
 
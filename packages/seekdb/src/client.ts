@@ -11,6 +11,15 @@ import type {
   SeekdbClientArgs,
   CreateCollectionOptions,
   GetCollectionOptions,
+  ExecuteStreamOptions,
+  InternalExecuteOptions,
+  BatchStatement,
+  ExecuteBatchOptions,
+  EmbeddedPoolStats,
+  EmbeddedQueryStats,
+  SeekdbTransaction,
+  WarmupOptions,
+  RowArrayResult,
 } from "./types.js";
 import type { Collection } from "./collection.js";
 import type { Database } from "./database.js";
@@ -53,6 +62,36 @@ export class SeekdbClient {
     await this._delegate.close();
   }
 
+  /**
+   * Release the client for graceful shutdown. Embedded mode disconnects and releases the
+   * database off the event loop (close() leaves it running); server mode is the same as close().
+   */
+  async shutdown(): Promise<void> {
+    if (this._delegate instanceof SeekdbEmbeddedClient) {
+      await this._delegate.shutdown();
+    } else {
+      await this._delegate.close();
+    }
+  }
+
+  /**
+   * Embedded execute() statistics (latency histograms per phase); null in server mode
+   */
+  queryStats(reset?: boolean): EmbeddedQueryStats | null {
+    return this._delegate instanceof SeekdbEmbeddedClient
+      ? this._delegate.queryStats(reset)
+      : null;
+  }
+
+  /**
+   * Embedded connection pool statistics; null in server mode or without the `pool` option
+   */
+  poolStats(): EmbeddedPoolStats | null {
+    return this._delegate instanceof SeekdbEmbeddedClient
+      ? this._delegate.poolStats()
+      : null;
+  }
+
   // ==================== Collection Management ====================
 
   /**
@@ -115,6 +154,14 @@ export class SeekdbClient {
     return this._delegate.countCollection();
   }
 
+  /**
+   * Drop cached collections (see collectionCacheTtl) for name, or all of them.
+   * Only needed after changes made outside this client.
+   */
+  invalidateCollectionCache(name?: string): void {
+    this._delegate.invalidateCollectionCache(name);
+  }
+
   // ==================== Database Management (admin) ====================
   // Explicit createDatabase: no auto-create on connect. Aligns with server and pyseekdb.
 
@@ -143,8 +190,62 @@ export class SeekdbClient {
    */
   async execute(
     sql: string,
-    params?: unknown[]
+    params?: unknown[],
+    options?: InternalExecuteOptions
   ): Promise<import("mysql2/promise").RowDataPacket[] | null> {
-    return this._delegate.execute(sql, params);
+    return this._delegate.execute(sql, params, options);
+  }
+
+  /**
+   * Execute raw SQL and return array rows with column metadata.
+   */
+  async executeRows(
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowArrayResult> {
+    return this._delegate.executeRows(sql, params, options);
+  }
+
+  /**
+   * Execute raw SQL and iterate the rows in batches.
+   */
+  executeStream(
+    sql: string,
+    params?: unknown[],
+    options?: ExecuteStreamOptions
+  ): AsyncGenerator<import("mysql2/promise").RowDataPacket[]> {
+    return this._delegate.executeStream(sql, params, options);
+  }
+
+  /**
+   * Execute several statements in order and return one result per statement.
+   */
+  async executeBatch(
+    statements: BatchStatement[],
+    options?: ExecuteBatchOptions
+  ): Promise<(import("mysql2/promise").RowDataPacket[] | null)[]> {
+    return this._delegate.executeBatch(statements, options);
+  }
+
+  /**
+   * Load the addon, connect and preload the named collections and their indexes up front.
+   */
+  async warmup(options?: WarmupOptions): Promise<void> {
+    return this._delegate.warmup(options);
+  }
+
+  /**
+   * Start an explicit transaction for raw SQL; commit() or rollback() ends it.
+   */
+  async beginTransaction(): Promise<SeekdbTransaction> {
+    return this._delegate.beginTransaction();
+  }
+
+  /**
+   * Run fn in a transaction: committed when fn resolves, rolled back when it throws.
+   */
+  async transaction<T>(fn: (tx: SeekdbTransaction) => Promise<T>): Promise<T> {
+    return this._delegate.transaction(fn);
   }
 }
@@ -2,13 +2,16 @@
  * Collection class - represents a collection of documents with vector embeddings
  */
 
+import type { RowDataPacket } from "mysql2/promise";
 import { SQLBuilder } from "./sql-builder.js";
 import { SeekdbValueError } from "./errors.js";
 import {
   CollectionFieldNames,
   CollectionNames,
   DEFAULT_DISTANCE_METRIC,
+  executeMany,
   isSparseVector,
+  parseVectorValue,
 } from "./utils.js";
 import { FilterBuilder } from "./filters.js";
 import {
@@ -21,6 +24,9 @@ import {
   type SparseEmbeddingFunction,
   type Metadata,
   type AddOptions,
+  type AddStreamRecord,
+  type AddStreamOptions,
+  type AddStreamResult,
   type UpdateOptions,
   type UpsertOptions,
   type DeleteOptions,
@@ -96,6 +102,7 @@ export class Collection {
       collectionId: this.collectionId,
       dimension: this.dimension,
       distance: this.distance,
+      vectorFormat: this.#client.supportsFloat32Vectors ? "float32" : "string",
     };
   }
 
@@ -151,7 +158,7 @@ export class Collection {
     documentsArray?: (string | null)[],
     metadatasArray?: (Metadata | null)[],
     clearOnNull: boolean = false
-  ): Promise<(SparseVector | null)[] | undefined> {
+  ): Promise<(SparseVector | string | null)[] | undefined> {
     const sparseConfig = this.schema?.sparseVectorIndex;
     const { sourceKey, embeddingFunction: sparseEmbeddingFunction } =
       sparseConfig ?? {};
@@ -171,7 +178,7 @@ export class Collection {
     const idx: number[] = [];
     const toGen: string[] = [];
 
-    const sparseEmbeddingsArray: (SparseVector | null)[] | undefined =
+    const sparseEmbeddingsArray: (SparseVector | string | null)[] | undefined =
       Array.from({ length: texts.length }, () => null);
 
     for (let i = 0; i < texts.length; i++) {
@@ -185,7 +192,9 @@ export class Collection {
     }
 
     if (toGen.length > 0) {
-      const generated = await sparseEmbeddingFunction.generate(toGen);
+      const generated = sparseEmbeddingFunction.generateSerialized
+        ? await sparseEmbeddingFunction.generateSerialized(toGen)
+        : await sparseEmbeddingFunction.generate(toGen);
       for (let i = 0; i < generated.length; i++) {
         sparseEmbeddingsArray[idx[i]] = generated[i] ?? null;
       }
@@ -264,6 +273,112 @@ export class Collection {
    * Add data to collection
    */
   async add(options: AddOptions): Promise<void> {
+    await this.insertRows(await this.prepareRows(options));
+  }
+
+  /**
+   * Add records from a (possibly async) iterable in chunks, pipelining embedding with inserts:
+   * up to `concurrency` chunks are embedded at once while finished chunks are inserted in
+   * input order, and the source is only read ahead as far as that window allows.
+   * Each chunk is inserted atomically; on failure no further chunks are started, chunks
+   * already inserted stay, and the first error is thrown.
+   */
+  async addStream(
+    records: AsyncIterable<AddStreamRecord> | Iterable<AddStreamRecord>,
+    options: AddStreamOptions = {}
+  ): Promise<AddStreamResult> {
+    const { chunkSize = 500, concurrency = 4, onProgress } = options;
+    if (!Number.isInteger(chunkSize) || chunkSize <= 0) {
+      throw new SeekdbValueError("chunkSize must be a positive integer");
+    }
+    if (!Number.isInteger(concurrency) || concurrency <= 0) {
+      throw new SeekdbValueError("concurrency must be a positive integer");
+    }
+
+    const result: AddStreamResult = { inserted: 0, chunks: 0 };
+    let failure: { error: unknown } | undefined;
+    let previous: Promise<void> = Promise.resolve();
+    const inFlight: Promise<void>[] = [];
+
+    const launch = (chunk: AddStreamRecord[]) => {
+      // Embedding starts now; the insert waits for the previous chunk's insert
+      const prepared = Promise.resolve().then(() =>
+        this.prepareRows(Collection.recordsToAddOptions(chunk))
+      );
+      prepared.catch(() => {}); // Surfaced through `done`
+      const done = previous
+        .then(async () => {
+          const rows = await prepared;
+          if (failure) return;
+          await this.insertRows(rows);
+          result.inserted += chunk.length;
+          result.chunks++;
+          onProgress?.({ ...result });
+        })
+        .catch((error) => {
+          failure ??= { error };
+        });
+      previous = done;
+      inFlight.push(done);
+    };
+
+    let chunk: AddStreamRecord[] = [];
+    try {
+      for await (const record of records) {
+        chunk.push(record);
+        if (chunk.length < chunkSize) continue;
+        launch(chunk);
+        chunk = [];
+        if (inFlight.length >= concurrency) {
+          await inFlight.shift();
+        }
+        if (failure) break;
+      }
+      if (chunk.length > 0 && !failure) {
+        launch(chunk);
+      }
+    } finally {
+      // A throwing source still settles the chunks already launched
+      await Promise.allSettled(inFlight);
+    }
+
+    if (failure) {
+      throw failure.error;
+    }
+    return result;
+  }
+
+  /**
+   * One addStream() chunk as add() options
+   * @private
+   */
+  private static recordsToAddOptions(records: AddStreamRecord[]): AddOptions {
+    const withEmbedding = records.filter((r) => r.embedding !== undefined);
+    if (withEmbedding.length > 0 && withEmbedding.length < records.length) {
+      throw new SeekdbValueError(
+        "addStream records must either all have embeddings or none"
+      );
+    }
+    return {
+      ids: records.map((r) => r.id),
+      embeddings:
+        withEmbedding.length > 0 ? records.map((r) => r.embedding!) : undefined,
+      documents: records.some((r) => r.document != null)
+        ? (records.map((r) => r.document ?? null) as string[])
+        : undefined,
+      metadatas: records.some((r) => r.metadata != null)
+        ? (records.map((r) => r.metadata ?? null) as Metadata[])
+        : undefined,
+    };
+  }
+
+  /**
+   * Normalize add() input, generate dense/sparse embeddings and validate dimensions
+   * @private
+   */
+  private async prepareRows(
+    options: AddOptions
+  ): Promise<Parameters<typeof SQLBuilder.buildInsert>[1]> {
     let { ids, embeddings, metadatas, documents } = options;
 
     // Normalize to arrays
@@ -322,14 +437,35 @@ export class Collection {
       }
     }
 
-    const { sql, params } = SQLBuilder.buildInsert(this.context, {
+    return {
       ids: idsArray,
       documents: documentsArray ?? undefined,
       embeddings: embeddingsArray,
       sparseEmbeddings: sparseEmbeddingsArray ?? undefined,
       metadatas: metadatasArray ?? undefined,
-    });
+    };
+  }
 
+  /**
+   * Insert rows prepared by prepareRows() in one all-or-nothing write
+   * @private
+   */
+  private async insertRows(
+    insertData: Parameters<typeof SQLBuilder.buildInsert>[1]
+  ): Promise<void> {
+    if (this.#client.bulkInsert) {
+      // Chunked natively; one transaction keeps add() all-or-nothing
+      const { table, columns, data } = SQLBuilder.buildBulkInsert(
+        this.context,
+        insertData
+      );
+      await this.#client.bulkInsert(table, columns, data, {
+        transactional: true,
+      });
+      return;
+    }
+
+    const { sql, params } = SQLBuilder.buildInsert(this.context, insertData);
     await this.#client.execute(sql, params);
   }
 
@@ -381,7 +517,7 @@ export class Collection {
       throw new SeekdbValueError("Length mismatch: embeddings vs ids");
     }
 
-    let sparseUpdates: (SparseVector | null | undefined)[] | undefined;
+    let sparseUpdates: (SparseVector | string | null | undefined)[] | undefined;
     const sparseConfig = this.schema?.sparseVectorIndex;
     const { sourceKey, embeddingFunction: sparseEmbeddingFunction } =
       sparseConfig ?? {};
@@ -413,7 +549,7 @@ export class Collection {
       const updates: {
         document?: string;
         embedding?: number[];
-        sparseEmbedding?: SparseVector | null;
+        sparseEmbedding?: SparseVector | string | null;
         metadata?: Metadata;
       } = {};
 
@@ -427,7 +563,10 @@ export class Collection {
         updates.embedding = embeddingsArray[i];
       }
       if (sparseUpdates && sparseUpdates[i] !== undefined) {
-        updates.sparseEmbedding = sparseUpdates[i] as SparseVector | null;
+        updates.sparseEmbedding = sparseUpdates[i] as
+          | SparseVector
+          | string
+          | null;
       }
 
       if (Object.keys(updates).length === 0) {
@@ -478,86 +617,93 @@ export class Collection {
       );
     }
 
-    // Upsert each item
-    for (let i = 0; i < idsArray.length; i++) {
-      const id = idsArray[i];
-
-      // Check if record exists
-      const existing = await this.get({
-        ids: [id],
-        include: ["documents", "metadatas", "embeddings"],
-      });
-
-      const doc = documentsArray?.[i];
-      const meta = metadatasArray?.[i];
-      const vec = embeddingsArray?.[i];
-
-      if (existing.ids.length > 0) {
-        // Update existing record
-        const updates: {
-          document?: string;
-          embedding?: number[];
-          sparseEmbedding?: SparseVector | null;
-          metadata?: Metadata;
-        } = {};
-
-        if (doc !== undefined) {
-          updates.document = doc;
-        }
-        if (meta !== undefined) {
-          updates.metadata = meta;
-        }
-        if (vec !== undefined) {
-          updates.embedding = vec;
+    // Validate lengths
+    if (documentsArray && documentsArray.length !== idsArray.length) {
+      throw new SeekdbValueError("Length mismatch: documents vs ids");
+    }
+    if (metadatasArray && metadatasArray.length !== idsArray.length) {
+      throw new SeekdbValueError("Length mismatch: metadatas vs ids");
+    }
+    if (embeddingsArray) {
+      if (embeddingsArray.length !== idsArray.length) {
+        throw new SeekdbValueError("Length mismatch: embeddings vs ids");
+      }
+      for (let i = 0; i < embeddingsArray.length; i++) {
+        if (embeddingsArray[i].length !== this.dimension) {
+          throw new SeekdbValueError(
+            `Dimension mismatch at index ${i}. Expected ${this.dimension}, got ${embeddingsArray[i].length}`
+          );
         }
+      }
+    } else {
+      // Without embeddings only existing rows can be upserted: one lookup
+      // instead of a SELECT per id
+      const existing = await this.get({ ids: idsArray, include: [] });
+      const found = new Set(existing.ids);
+      const missing = idsArray.filter((id) => !found.has(id));
+      if (missing.length > 0) {
+        throw new SeekdbValueError(
+          `Embeddings or documents with an embedding function are required to insert new ids: ${missing.join(", ")}`
+        );
+      }
+    }
 
-        const sparseConfig = this.schema?.sparseVectorIndex;
-        const { sourceKey, embeddingFunction: sparseEmbeddingFunction } =
-          sparseConfig ?? {};
-        if (sparseEmbeddingFunction) {
-          const sourceKeyName = this.normalizeSourceKey(sourceKey);
-          const fromDocument =
-            sourceKeyName === "#document" || sourceKeyName === "document";
-          const fromMetadata =
-            typeof sourceKeyName === "string" &&
-            sourceKeyName.startsWith("metadata.");
-          const shouldCompute =
-            (fromDocument && doc !== undefined) ||
-            (fromMetadata && meta !== undefined);
-
-          if (shouldCompute) {
-            const text = this.resolveSourceText(
-              sourceKey,
-              doc ?? null,
-              meta ?? null
-            );
-            if (text) {
-              const generated = await sparseEmbeddingFunction.generate([text]);
-              updates.sparseEmbedding =
-                (generated[0] as SparseVector | undefined) ?? null;
-            } else {
-              updates.sparseEmbedding = null;
-            }
-          }
-        }
+    // Existing rows only take the provided fields; new rows are inserted whole
+    const updateColumns: string[] = [];
+    if (documentsArray) updateColumns.push(CollectionFieldNames.DOCUMENT);
+    if (metadatasArray) updateColumns.push(CollectionFieldNames.METADATA);
+    if (embeddingsArray) updateColumns.push(CollectionFieldNames.EMBEDDING);
 
-        if (Object.keys(updates).length > 0) {
-          const { sql, params } = SQLBuilder.buildUpdate(this.context, {
-            id,
-            updates,
-          });
-          await this.#client.execute(sql, params);
-        }
-      } else {
-        // Insert new record using add method
-        await this.add({
-          ids: [id],
-          documents: doc ? [doc] : undefined,
-          metadatas: meta ? [meta] : undefined,
-          embeddings: vec ? [vec] : undefined,
-        });
+    // Sparse embeddings for the whole batch; existing rows are only
+    // overwritten when their source field was provided
+    const sparseEmbeddingsArray = await this.generateSparseEmbeddings(
+      idsArray,
+      documentsArray,
+      metadatasArray,
+      true
+    );
+    if (sparseEmbeddingsArray) {
+      const sourceKeyName = this.normalizeSourceKey(
+        this.schema?.sparseVectorIndex?.sourceKey
+      );
+      const fromDocument =
+        sourceKeyName === "#document" || sourceKeyName === "document";
+      const fromMetadata =
+        typeof sourceKeyName === "string" &&
+        sourceKeyName.startsWith("metadata.");
+      if (
+        (fromDocument && documentsArray) ||
+        (fromMetadata && metadatasArray)
+      ) {
+        updateColumns.push(CollectionFieldNames.SPARSE_EMBEDDING);
       }
     }
+
+    const rows = {
+      ids: idsArray,
+      documents: documentsArray,
+      embeddings: embeddingsArray,
+      sparseEmbeddings: sparseEmbeddingsArray,
+      metadatas: metadatasArray,
+    };
+    if (this.#client.bulkInsert) {
+      const { table, columns, data } = SQLBuilder.buildBulkUpsert(
+        this.context,
+        rows,
+        updateColumns
+      );
+      await this.#client.bulkInsert(table, columns, data, {
+        transactional: true,
+      });
+      return;
+    }
+
+    const { sql, params } = SQLBuilder.buildUpsert(
+      this.context,
+      rows,
+      updateColumns
+    );
+    await this.#client.execute(sql, params);
   }
 
   /**
@@ -612,7 +758,10 @@ export class Collection {
       include: include as string[] | undefined,
     });
 
-    const rows = await this.#client.execute(sql, params);
+    const rows = await this.#client.execute(sql, params, {
+      vectorFormat: this.context.vectorFormat,
+      jsonColumns: [CollectionFieldNames.METADATA],
+    });
 
     // Use mutable arrays internally, then return as readonly
     const resultIds: string[] = [];
@@ -636,9 +785,8 @@ export class Collection {
         }
 
         if (!include || include.includes("embeddings")) {
-          const vec = row[CollectionFieldNames.EMBEDDING];
           resultEmbeddings.push(
-            vec ? (typeof vec === "string" ? JSON.parse(vec) : vec) : null
+            parseVectorValue(row[CollectionFieldNames.EMBEDDING])
           );
         }
       }
@@ -741,25 +889,34 @@ export class Collection {
     const allEmbeddings: number[][][] = [];
     const allDistances: number[][] = [];
 
-    // Query for each vector
-    for (const queryVector of queryVectors) {
-      // Build vector query SQL using SQLBuilder
-      const { sql, params } = SQLBuilder.buildVectorQuery(
-        this.context,
-        queryVector as any,
-        nResults,
-        {
-          where,
-          whereDocument,
-          include: include as string[] | undefined,
-          distance: distance ?? this.distance,
-          approximate,
-          column,
-        }
-      );
-
-      const rows = await this.#client.execute(sql, params);
-
+    // Build one vector query per vector; the reads are independent, so they
+    // are submitted together instead of awaited one by one
+    const statements = queryVectors.map((queryVector) =>
+      SQLBuilder.buildVectorQuery(this.context, queryVector as any, nResults, {
+        where,
+        whereDocument,
+        include: include as string[] | undefined,
+        distance: distance ?? this.distance,
+        approximate,
+        column,
+      })
+    );
+    const executeOptions = {
+      vectorFormat: this.context.vectorFormat,
+      jsonColumns: [CollectionFieldNames.METADATA],
+    };
+    const results =
+      statements.length === 1
+        ? [
+            await this.#client.execute(
+              statements[0].sql,
+              statements[0].params,
+              executeOptions
+            ),
+          ]
+        : await executeMany(this.#client, statements, executeOptions);
+
+    for (const rows of results) {
       const queryIds: string[] = [];
       const queryDocuments: (string | null)[] = [];
       const queryMetadatas: (TMeta | null)[] = [];
@@ -782,9 +939,8 @@ export class Collection {
           }
 
           if (include?.includes("embeddings")) {
-            const vec = row[CollectionFieldNames.EMBEDDING];
             queryEmbeddings.push(
-              vec ? (typeof vec === "string" ? JSON.parse(vec) : vec) : null
+              parseVectorValue(row[CollectionFieldNames.EMBEDDING]) as number[]
             );
           }
 
@@ -960,23 +1116,12 @@ export class Collection {
     }
 
     // Execute hybrid search using DBMS_HYBRID_SEARCH
-    const searchParmJson = JSON.stringify(searchParm);
     const tableName = CollectionNames.tableName(this.name, this.collectionId);
+    const resultRows = this.#client.hybridSearch
+      ? await this.#client.hybridSearch(tableName, searchParm)
+      : await this.runHybridSearchSteps(tableName, searchParm);
 
-    // Set search_parm variable
-    const { sql: setVarSql, params: setVarParams } =
-      SQLBuilder.buildSetVariable("search_parm", searchParmJson);
-    await this.#client.execute(setVarSql, setVarParams);
-
-    // Get SQL query from DBMS_HYBRID_SEARCH.GET_SQL
-    const getSqlQuery = SQLBuilder.buildHybridSearchGetSql(tableName);
-    const getSqlResult = await this.#client.execute(getSqlQuery);
-
-    if (
-      !getSqlResult ||
-      getSqlResult.length === 0 ||
-      !getSqlResult[0].query_sql
-    ) {
+    if (!resultRows) {
       return {
         ids: [[]],
         distances: [[]],
@@ -986,16 +1131,6 @@ export class Collection {
       };
     }
 
-    // Execute the returned SQL query with security validation
-    const querySql = getSqlResult[0].query_sql
-      .trim()
-      .replace(/^['"]|['"]$/g, "");
-
-    // Security check: Validate the SQL query before execution
-    this.validateDynamicSql(querySql);
-
-    const resultRows = await this.#client.execute(querySql);
-
     // Transform results
     const ids: string[] = [];
     const documents: (string | null)[] = [];
@@ -1060,6 +1195,43 @@ export class Collection {
     return result;
   }
 
+  /**
+   * Hybrid search as separate statements: SET @search_parm, GET_SQL, then the
+   * validated SQL; resolves with null when GET_SQL returns no SQL
+   * @private
+   */
+  private async runHybridSearchSteps(
+    tableName: string,
+    searchParm: object
+  ): Promise<RowDataPacket[] | null> {
+    // Set search_parm variable
+    const { sql: setVarSql, params: setVarParams } =
+      SQLBuilder.buildSetVariable("search_parm", JSON.stringify(searchParm));
+    await this.#client.execute(setVarSql, setVarParams);
+
+    // Get SQL query from DBMS_HYBRID_SEARCH.GET_SQL
+    const getSqlQuery = SQLBuilder.buildHybridSearchGetSql(tableName);
+    const getSqlResult = await this.#client.execute(getSqlQuery);
+
+    if (
+      !getSqlResult ||
+      getSqlResult.length === 0 ||
+      !getSqlResult[0].query_sql
+    ) {
+      return null;
+    }
+
+    // Execute the returned SQL query with security validation
+    const querySql = getSqlResult[0].query_sql
+      .trim()
+      .replace(/^['"]|['"]$/g, "");
+
+    // Security check: Validate the SQL query before execution
+    this.validateDynamicSql(querySql);
+
+    return (await this.#client.execute(querySql)) ?? [];
+  }
+
   async fork(options: ForkOptions): Promise<Collection> {
     const { name: targetName } = options;
 
@@ -1119,6 +1291,7 @@ export class Collection {
       throw error;
     }
 
+    this.client.invalidateCollectionCache(targetName);
     return new Collection({
       name: targetName,
       schema: this.schema,
@@ -66,14 +66,17 @@ export class Connection {
    * Execute SQL query
    * @param sql - SQL statement to execute
    * @param params - Parameters for the query
+   * @param timeoutMs - Optional mysql2 per-query timeout in milliseconds
    * @returns Query results for SELECT/SHOW/DESCRIBE statements, null for others
    */
   async execute(
     sql: string,
-    params?: unknown[]
+    params?: unknown[],
+    timeoutMs?: number
   ): Promise<RowDataPacket[] | null> {
     const conn = await this.ensureConnection();
     const sqlUpper = sql.trim().toUpperCase();
+    const query = { sql, timeout: timeoutMs };
 
     // Return rows for SELECT-like queries
     if (
@@ -82,12 +85,12 @@ export class Connection {
       sqlUpper.startsWith("DESCRIBE") ||
       sqlUpper.startsWith("DESC")
     ) {
-      const [rows] = await conn.query<RowDataPacket[]>(sql, params);
+      const [rows] = await conn.query<RowDataPacket[]>(query, params);
       return rows;
     }
 
     // Execute without returning rows for DDL/DML statements
-    await conn.query(sql, params);
+    await conn.query(query, params);
     return null;
   }
 
@@ -1,4 +1,5 @@
 import {
+  EmbeddingCacheOptions,
   EmbeddingFunction,
   EmbeddingFunctionConstructor,
   SparseEmbeddingFunction,
@@ -15,6 +16,203 @@ const sparseRegistry: Map<string, SparseEmbeddingFunctionConstructor> =
   (globalThis as any)[SPARSE_REGISTRY_KEY] ??
   ((globalThis as any)[SPARSE_REGISTRY_KEY] = new Map());
 
+const EMBEDDING_CACHE_KEY = "seekdb:embeddingCache";
+const DEFAULT_EMBEDDING_CACHE_ENTRIES = 10000;
+
+// JSON with object keys sorted, so equal configs give equal cache keys
+function canonicalJson(value: unknown): string {
+  return JSON.stringify(value ?? null, (_key, v) =>
+    v && typeof v === "object" && !Array.isArray(v)
+      ? Object.fromEntries(
+          Object.entries(v).sort(([a], [b]) => (a < b ? -1 : a > b ? 1 : 0))
+        )
+      : v
+  );
+}
+
+/**
+ * Bounded LRU of generated vectors, keyed by (function name, config, text).
+ *
+ * Vectors are kept as Float32Array, the precision VECTOR columns store, and
+ * misses are rounded to it as well, so a text embeds the same whether or not
+ * it was cached. A text that is already being generated is not generated
+ * again: concurrent requests for it share the one generation.
+ *
+ * @experimental This API is experimental and may change in future versions.
+ */
+export class EmbeddingCache {
+  // LRU: Map keeps insertion order
+  readonly #entries = new Map<string, Float32Array>();
+  readonly #inFlight = new Map<string, Promise<Float32Array>>();
+  readonly #maxEntries: number;
+  #hits = 0;
+  #misses = 0;
+
+  constructor(options: EmbeddingCacheOptions = {}) {
+    this.#maxEntries = Math.max(
+      0,
+      options.maxEntries ?? DEFAULT_EMBEDDING_CACHE_ENTRIES
+    );
+  }
+
+  /** Cached vectors, and texts served from the cache (hits) or generated */
+  stats(): { size: number; hits: number; misses: number } {
+    return {
+      size: this.#entries.size,
+      hits: this.#hits,
+      misses: this.#misses,
+    };
+  }
+
+  clear(): void {
+    this.#entries.clear();
+    this.#inFlight.clear();
+  }
+
+  /**
+   * Embed texts with ef. Texts that are neither cached nor being generated go
+   * to ef.generate() in one call, each once.
+   */
+  async generate(ef: EmbeddingFunction, texts: string[]): Promise<number[][]> {
+    let prefix: string;
+    try {
+      prefix = `${ef.name}\u0000${canonicalJson(ef.getConfig())}\u0000`;
+    } catch {
+      // No usable config to key on
+      return ef.generate(texts);
+    }
+
+    const keys = texts.map((text) => prefix + text);
+    const missing = new Map<string, string>();
+    keys.forEach((key, i) => {
+      if (!this.#entries.has(key) && !this.#inFlight.has(key)) {
+        missing.set(key, texts[i]);
+      }
+    });
+    if (missing.size > 0) this.#startGeneration(ef, missing);
+    this.#misses += missing.size;
+    this.#hits += keys.length - missing.size;
+
+    const vectors = keys.map((key) => {
+      const cached = this.#entries.get(key);
+      if (!cached) return this.#inFlight.get(key)!;
+      this.#entries.delete(key);
+      this.#entries.set(key, cached);
+      return cached;
+    });
+    return (await Promise.all(vectors)).map((v) => Array.from(v));
+  }
+
+  #startGeneration(ef: EmbeddingFunction, missing: Map<string, string>): void {
+    const keys = [...missing.keys()];
+    const generation = ef.generate([...missing.values()]).then((vectors) => {
+      if (!Array.isArray(vectors) || vectors.length !== keys.length) {
+        throw new Error(
+          `Embedding function '${ef.name}' returned ${vectors?.length} vectors for ${keys.length} texts`
+        );
+      }
+      return vectors.map((v) => Float32Array.from(v));
+    });
+
+    keys.forEach((key, i) => {
+      const vector = generation.then((vectors) => vectors[i]);
+      this.#inFlight.set(key, vector);
+      // Failures are not cached; the callers waiting on vector see them
+      vector.then(
+        (v) => {
+          if (this.#inFlight.get(key) !== vector) return;
+          this.#inFlight.delete(key);
+          this.#store(key, v);
+        },
+        () => {
+          if (this.#inFlight.get(key) === vector) this.#inFlight.delete(key);
+        }
+      );
+    });
+  }
+
+  #store(key: string, vector: Float32Array): void {
+    if (this.#maxEntries === 0) return;
+    this.#entries.set(key, vector);
+    if (this.#entries.size > this.#maxEntries) {
+      this.#entries.delete(this.#entries.keys().next().value!);
+    }
+  }
+}
+
+/**
+ * EmbeddingFunction that serves generate() through an EmbeddingCache.
+ *
+ * name, getConfig() and dimension are the wrapped function's, so collections
+ * created with it persist the wrapped function.
+ *
+ * @experimental This API is experimental and may change in future versions.
+ */
+export class CachedEmbeddingFunction implements EmbeddingFunction {
+  constructor(
+    readonly inner: EmbeddingFunction,
+    readonly cache: EmbeddingCache
+  ) {}
+
+  get name(): string {
+    return this.inner.name;
+  }
+
+  get dimension(): number | undefined {
+    return this.inner.dimension;
+  }
+
+  generate(texts: string[]): Promise<number[][]> {
+    return this.cache.generate(this.inner, texts);
+  }
+
+  getConfig() {
+    return this.inner.getConfig();
+  }
+
+  async dispose(): Promise<void> {
+    await this.inner.dispose?.();
+  }
+}
+
+/**
+ * Wrap an embedding function so repeated texts are served from a cache.
+ *
+ * @experimental This API is experimental and may change in future versions.
+ * @param ef - The embedding function to wrap
+ * @param cache - A cache to share, or options for a new one
+ */
+export function withEmbeddingCache(
+  ef: EmbeddingFunction,
+  cache: EmbeddingCache | EmbeddingCacheOptions = {}
+): CachedEmbeddingFunction {
+  const inner = ef instanceof CachedEmbeddingFunction ? ef.inner : ef;
+  return new CachedEmbeddingFunction(
+    inner,
+    cache instanceof EmbeddingCache ? cache : new EmbeddingCache(cache)
+  );
+}
+
+/**
+ * Cache the vectors of every embedding function that getEmbeddingFunction()
+ * returns from now on, which includes the functions restored for existing
+ * collections. null turns it off again.
+ *
+ * @experimental This API is experimental and may change in future versions.
+ * @param cache - The cache to use, options for a new one, or null
+ * @returns The cache now in use, or null
+ */
+export function setEmbeddingCache(
+  cache: EmbeddingCache | EmbeddingCacheOptions | null
+): EmbeddingCache | null {
+  const next =
+    cache === null || cache instanceof EmbeddingCache
+      ? cache
+      : new EmbeddingCache(cache);
+  (globalThis as any)[EMBEDDING_CACHE_KEY] = next;
+  return next;
+}
+
 /**
  * Register a custom embedding function.
  *
@@ -69,6 +267,9 @@ export function supportsPersistence(
   if (ef == null) {
     return false;
   }
+  if (ef instanceof CachedEmbeddingFunction) {
+    return supportsPersistence(ef.inner);
+  }
 
   // Check if getConfig method exists
   if (typeof ef.getConfig !== "function") {
@@ -141,11 +342,13 @@ export async function getEmbeddingFunction(
     }
     const Ctor = denseRegistry.get(name)!;
 
-    if (Ctor.buildFromConfig) {
-      return Ctor.buildFromConfig(finalConfig);
-    }
     // Instantiate (if configuration is incorrect, the constructor will throw)
-    return new Ctor(finalConfig);
+    const ef = await (Ctor.buildFromConfig
+      ? Ctor.buildFromConfig(finalConfig)
+      : new Ctor(finalConfig));
+    const cache: EmbeddingCache | null =
+      (globalThis as any)[EMBEDDING_CACHE_KEY] ?? null;
+    return cache ? withEmbeddingCache(ef, cache) : ef;
   } catch (error) {
     throw new Error(
       `Failed to instantiate embedding function '${name}': ${error instanceof Error ? error.message : String(error)}`
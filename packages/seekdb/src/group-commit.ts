@@ -0,0 +1,112 @@
+/**
+ * Group commit for autocommit writes: writes queued while a group commits
+ * share the next transaction, so concurrent writers pay one commit per group
+ * instead of one each.
+ */
+
+import type { GroupCommitOptions } from "./types.js";
+
+/** Transaction a group runs in */
+export interface GroupCommitTransaction {
+  commit(): Promise<void>;
+  rollback(): Promise<void>;
+}
+
+/** A queued write; runs in tx, or in autocommit when tx is null */
+export type GroupCommitWrite<Tx, T> = (tx: Tx | null) => Promise<T>;
+
+interface PendingWrite<Tx> {
+  write: GroupCommitWrite<Tx, unknown>;
+  resolve(value: unknown): void;
+  reject(error: unknown): void;
+}
+
+export class GroupCommitQueue<Tx extends GroupCommitTransaction> {
+  readonly #begin: () => Promise<Tx>;
+  readonly #maxStatements: number;
+  readonly #maxDelayMs: number;
+  #pending: PendingWrite<Tx>[] = [];
+  #scheduled = false;
+  #flushing = false;
+
+  /**
+   * @param begin - Starts the transaction of a group
+   * @param options - Group size and collection delay
+   */
+  constructor(begin: () => Promise<Tx>, options: GroupCommitOptions = {}) {
+    this.#begin = begin;
+    this.#maxStatements = Math.max(1, options.maxStatements ?? 64);
+    this.#maxDelayMs = Math.max(0, options.maxDelayMs ?? 0);
+  }
+
+  /** Queue a write; settles once its group has committed */
+  run<T>(write: GroupCommitWrite<Tx, T>): Promise<T> {
+    return new Promise<T>((resolve, reject) => {
+      this.#pending.push({
+        write,
+        resolve: resolve as (value: unknown) => void,
+        reject,
+      });
+      this.#schedule();
+    });
+  }
+
+  #schedule(): void {
+    if (this.#scheduled || this.#flushing) return;
+    this.#scheduled = true;
+    const flush = () => {
+      this.#scheduled = false;
+      void this.#flush();
+    };
+    if (this.#maxDelayMs > 0) setTimeout(flush, this.#maxDelayMs);
+    else setImmediate(flush);
+  }
+
+  // One group at a time; writes queued meanwhile form the next group
+  async #flush(): Promise<void> {
+    this.#flushing = true;
+    try {
+      while (this.#pending.length > 0) {
+        const group = this.#pending.splice(0, this.#maxStatements);
+        if (group.length === 1 || !(await this.#commitGroup(group))) {
+          await Promise.all(group.map((pending) => this.#runAlone(pending)));
+        }
+      }
+    } finally {
+      this.#flushing = false;
+    }
+  }
+
+  // Resolves with false, having rolled back, if the group has to be retried write by write
+  async #commitGroup(group: PendingWrite<Tx>[]): Promise<boolean> {
+    let tx: Tx;
+    try {
+      tx = await this.#begin();
+    } catch {
+      return false;
+    }
+    const results: unknown[] = [];
+    try {
+      for (const { write } of group) results.push(await write(tx));
+    } catch {
+      await tx.rollback().catch(() => undefined);
+      return false;
+    }
+    try {
+      await tx.commit();
+    } catch {
+      // A failed commit is rolled back by the transaction itself
+      return false;
+    }
+    group.forEach((pending, i) => pending.resolve(results[i]));
+    return true;
+  }
+
+  async #runAlone(pending: PendingWrite<Tx>): Promise<void> {
+    try {
+      pending.resolve(await pending.write(null));
+    } catch (error) {
+      pending.reject(error);
+    }
+  }
+}
@@ -0,0 +1,235 @@
+/**
+ * Cache of the SQL generated by DBMS_HYBRID_SEARCH.GET_SQL, keyed on the
+ * search_parm shape (the JSON with its values stripped)
+ *
+ * Search parms of the same shape generate the same SQL apart from the values.
+ * After a miss the SQL is generated once more for a copy of the parm whose
+ * values are unique sentinels; where the sentinels land turns that SQL into a
+ * template, which is kept only if rendering it with the real values reproduces
+ * the SQL the engine generated for them. Hits render the template locally, so
+ * neither GET_SQL nor its validation runs. Parms with strings that would need
+ * escaping always go to the engine.
+ */
+
+type Slot =
+  | { kind: "string"; index: number }
+  | { kind: "vector"; index: number; separator: string };
+
+/** Literal SQL text and the slots its values go in */
+type Template = (string | Slot)[];
+
+interface ParmValues {
+  key: string;
+  strings: string[];
+  vectors: number[][];
+}
+
+// String values of these keys are column names, which shape the SQL
+const STRUCTURAL_KEYS = new Set(["field", "fields"]);
+// Strings that go into a quoted literal without escaping
+const PLAIN_STRING = /^[^'"\\\u0000-\u001f]*$/;
+// Vector sentinels are (index + 1) * VECTOR_SENTINEL_BASE + position + 1
+const VECTOR_SENTINEL_BASE = 1_000_000;
+
+interface ValueMapper {
+  string(value: string): unknown;
+  vector(value: number[]): unknown;
+}
+
+// Copy of parm with its string and number-array values mapped, in JSON order
+function mapParm(value: unknown, key: string | null, map: ValueMapper): any {
+  if (typeof value === "string") {
+    return key !== null && STRUCTURAL_KEYS.has(key)
+      ? value
+      : map.string(value);
+  }
+  if (Array.isArray(value)) {
+    if (value.length > 0 && value.every((v) => typeof v === "number")) {
+      return map.vector(value);
+    }
+    return value.map((v) => mapParm(v, key, map));
+  }
+  if (value && typeof value === "object") {
+    const out: Record<string, unknown> = {};
+    for (const [k, v] of Object.entries(value)) out[k] = mapParm(v, k, map);
+    return out;
+  }
+  return value;
+}
+
+function isPlain(values: ParmValues): boolean {
+  return (
+    values.strings.every((s) => PLAIN_STRING.test(s)) &&
+    values.vectors.every((v) => v.every(Number.isFinite))
+  );
+}
+
+function stringSentinel(index: number): string {
+  return `seekdbhs${index}x`;
+}
+
+function vectorSentinel(index: number, length: number): number[] {
+  return Array.from(
+    { length },
+    (_, j) => (index + 1) * VECTOR_SENTINEL_BASE + j + 1
+  );
+}
+
+// Quote character whose literal contains pos, or null outside literals
+function quoteAt(sql: string, pos: number): string | null {
+  let quote: string | null = null;
+  for (let i = 0; i < pos; i++) {
+    const c = sql[i];
+    if (quote === null) {
+      if (c === "'" || c === '"' || c === "`") quote = c;
+    } else if (c === "\\" && quote !== "`") {
+      i++;
+    } else if (c === quote) {
+      if (sql[i + 1] === quote) i++;
+      else quote = null;
+    }
+  }
+  return quote === "`" ? null : quote;
+}
+
+// Template from the SQL generated for the sentinel parm, or null if a value
+// does not show up verbatim (or a string lands outside a string literal)
+function buildTemplate(
+  sql: string,
+  stringCount: number,
+  vectorLengths: number[]
+): Template | null {
+  const found: { start: number; end: number; slot: Slot }[] = [];
+  for (let i = 0; i < stringCount; i++) {
+    const sentinel = stringSentinel(i);
+    let pos = sql.indexOf(sentinel);
+    if (pos < 0) return null;
+    for (; pos >= 0; pos = sql.indexOf(sentinel, pos + sentinel.length)) {
+      if (quoteAt(sql, pos) === null) return null;
+      const slot: Slot = { kind: "string", index: i };
+      found.push({ start: pos, end: pos + sentinel.length, slot });
+    }
+  }
+  for (let i = 0; i < vectorLengths.length; i++) {
+    const parts = vectorSentinel(i, vectorLengths[i]).map(String);
+    const pattern = parts
+      .map((part, j) =>
+        j === 0 ? part : j === 1 ? `(\\s*,\\s*)${part}` : `(?:\\1)${part}`
+      )
+      .join("");
+    const regex = new RegExp(`(?<![\\w.+-])${pattern}(?![\\w.])`, "g");
+    const matches = [...sql.matchAll(regex)];
+    if (matches.length === 0) return null;
+    for (const match of matches) {
+      const slot: Slot = {
+        kind: "vector",
+        index: i,
+        separator: match[1] ?? ",",
+      };
+      const start = match.index!;
+      found.push({ start, end: start + match[0].length, slot });
+    }
+  }
+
+  found.sort((a, b) => a.start - b.start);
+  const template: Template = [];
+  let pos = 0;
+  for (const { start, end, slot } of found) {
+    if (start < pos) return null;
+    template.push(sql.slice(pos, start), slot);
+    pos = end;
+  }
+  template.push(sql.slice(pos));
+  return template;
+}
+
+function render(template: Template, values: ParmValues): string {
+  let sql = "";
+  for (const part of template) {
+    if (typeof part === "string") sql += part;
+    else if (part.kind === "string") sql += values.strings[part.index];
+    else sql += values.vectors[part.index].join(part.separator);
+  }
+  return sql;
+}
+
+export class HybridSearchSqlCache {
+  // LRU: Map keeps insertion order; null marks shapes that cannot be cached
+  readonly #entries = new Map<string, Template | null>();
+  readonly #maxEntries: number;
+
+  constructor(maxEntries: number) {
+    this.#maxEntries = maxEntries;
+  }
+
+  /** SQL for searchParm rendered from a cached template, or null on a miss */
+  get(table: string, searchParm: object): string | null {
+    const values = HybridSearchSqlCache.values(table, searchParm);
+    const template = this.#entries.get(values.key);
+    if (!template || !isPlain(values)) return null;
+    this.#entries.delete(values.key);
+    this.#entries.set(values.key, template);
+    return render(template, values);
+  }
+
+  /**
+   * Learn the template of searchParm's shape after a miss. sql is what the
+   * engine generated for searchParm; generate() asks the engine for the
+   * (validated) SQL of another parm of the same shape.
+   */
+  async learn(
+    table: string,
+    searchParm: object,
+    sql: string,
+    generate: (searchParm: object) => Promise<string | null>
+  ): Promise<void> {
+    const values = HybridSearchSqlCache.values(table, searchParm);
+    if (this.#entries.has(values.key) || !isPlain(values)) return;
+
+    let template: Template | null = null;
+    if (values.strings.length === 0 && values.vectors.length === 0) {
+      template = [sql];
+    } else if (values.vectors.every((v) => v.length < VECTOR_SENTINEL_BASE)) {
+      let strings = 0;
+      let vectors = 0;
+      const sentinelParm = mapParm(searchParm, null, {
+        string: () => stringSentinel(strings++),
+        vector: (v) => vectorSentinel(vectors++, v.length),
+      });
+      try {
+        const sentinelSql = await generate(sentinelParm);
+        template = sentinelSql
+          ? buildTemplate(
+              sentinelSql,
+              values.strings.length,
+              values.vectors.map((v) => v.length)
+            )
+          : null;
+      } catch {
+        template = null;
+      }
+      if (template && render(template, values) !== sql) template = null;
+    }
+
+    this.#entries.set(values.key, template);
+    if (this.#entries.size > this.#maxEntries) {
+      this.#entries.delete(this.#entries.keys().next().value!);
+    }
+  }
+
+  private static values(table: string, searchParm: object): ParmValues {
+    const strings: string[] = [];
+    const vectors: number[][] = [];
+    const shape = mapParm(searchParm, null, {
+      string: (s) => {
+        strings.push(s);
+        return "\u0000s";
+      },
+      vector: (v) => {
+        vectors.push(v);
+        return `\u0000v${v.length}`;
+      },
+    });
+    return { key: `${table}\n${JSON.stringify(shape)}`, strings, vectors };
+  }
+}
@@ -11,6 +11,10 @@ export {
   getEmbeddingFunction,
   registerSparseEmbeddingFunction,
   getSparseEmbeddingFunction,
+  EmbeddingCache,
+  CachedEmbeddingFunction,
+  withEmbeddingCache,
+  setEmbeddingCache,
 } from "./embedding-function.js";
 export {
   Schema,
@@ -32,4 +36,7 @@ export {
   DEFAULT_PORT,
   DEFAULT_USER,
   DEFAULT_CHARSET,
+  serializeSparseVector,
 } from "./utils.js";
+export { normalizeVectors, vectorDistances } from "./vector-kernels.js";
+export type { VectorBatch } from "./vector-kernels.js";
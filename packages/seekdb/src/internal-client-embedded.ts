@@ -2,65 +2,165 @@
  * Internal client for embedded mode (same interface as InternalClient, uses native addon).
  * Addon is loaded on first use; may trigger on-demand download via js-bindings.
  */
+import { channel } from "node:diagnostics_channel";
 import type { RowDataPacket } from "mysql2/promise";
-import type { IInternalClient } from "./types.js";
-import type { Database, Connection } from "@seekdb/js-bindings";
+import type {
+  IInternalClient,
+  InternalExecuteOptions,
+  ExecuteStreamOptions,
+  EmbeddedPoolOptions,
+  EmbeddedPoolStats,
+  EmbeddedExecutorOptions,
+  EmbeddedQueryStats,
+  EmbeddedQueryTiming,
+  BatchStatement,
+  ExecuteBatchOptions,
+  BulkInsertColumn,
+  BulkInsertOptions,
+  GroupCommitOptions,
+  RowArrayResult,
+  SeekdbTransaction,
+} from "./types.js";
+import type {
+  Database,
+  Connection,
+  Pool,
+  Transaction,
+} from "@seekdb/js-bindings";
 import type { NativeBindings } from "./native-addon-loader.js";
 import { getNativeAddon } from "./native-addon-loader.js";
+import { HybridSearchSqlCache } from "./hybrid-search-cache.js";
+import { GroupCommitQueue } from "./group-commit.js";
+import { SeekdbValueError } from "./errors.js";
 
-const _dbCache = new Map<string, Database>();
+// Database handles of this thread by path, with the number of clients using each. The engine
+// itself is shared process-wide: the native registry refcounts opens, so every worker thread
+// opening the same path joins one engine.
+const _dbCache = new Map<string, { db: Promise<Database>; users: number }>();
+
+// Session defaults so 100KB+ documents work without user config (align with server behavior).
+const SESSION_INIT_SQL = [
+  "SET SESSION ob_default_lob_inrow_threshold = 262144",
+  "SET SESSION max_allowed_packet = 2097152",
+];
+
+// Rows are built as objects natively; no per-cell re-mapping in JS
+const ROW_MODE = { rowMode: "object" } as const;
+
+// Receives { sql, timing: EmbeddedQueryTiming } after each execute(); timings are only
+// captured while someone is subscribed
+const queryChannel = channel("seekdb:query");
+
+// Autocommit writes that group commit may merge
+const GROUPABLE_WRITE = /^\s*(INSERT|UPDATE|DELETE|REPLACE)\b/i;
+
+// Native bulk_insert default; larger inserts span several statements
+const DEFAULT_BULK_CHUNK_SIZE = 1000;
+
+type TargetHandle = Connection | Pool | Transaction;
+
+/** beginTransaction() result; bulkInsert lets group commit merge bulk inserts */
+interface EmbeddedTransaction extends SeekdbTransaction {
+  bulkInsert(
+    table: string,
+    columns: BulkInsertColumn[],
+    data: unknown[][],
+    options?: BulkInsertOptions
+  ): Promise<number>;
+}
 
 export class InternalEmbeddedClient implements IInternalClient {
+  readonly supportsFloat32Vectors = true;
   private readonly path: string;
   private readonly database: string;
   private _db: Database | null = null;
-  private _connection: Connection | null = null;
+  private readonly poolOptions: EmbeddedPoolOptions | undefined;
+  private readonly executorOptions: EmbeddedExecutorOptions | undefined;
+  private _connection: Connection | Pool | null = null;
+  private _pool: Pool | null = null;
   private _initialized = false;
   private _addon: NativeBindings | null = null;
+  private readonly _hybridSqlCache: HybridSearchSqlCache | null;
+  private readonly _groupCommit: GroupCommitQueue<EmbeddedTransaction> | null;
+  private readonly _maxResultBytes: number | undefined;
 
-  constructor(args: { path: string; database: string }) {
+  constructor(args: {
+    path: string;
+    database: string;
+    pool?: EmbeddedPoolOptions;
+    executor?: EmbeddedExecutorOptions;
+    hybridSearchCache?: number;
+    groupCommit?: boolean | GroupCommitOptions;
+    maxResultBytes?: number;
+  }) {
     this.path = args.path;
     this.database = args.database;
+    this.poolOptions = args.pool;
+    this.executorOptions = args.executor;
+    this._maxResultBytes = args.maxResultBytes;
+    this._hybridSqlCache = args.hybridSearchCache
+      ? new HybridSearchSqlCache(args.hybridSearchCache)
+      : null;
+    // A group's transaction on the single shared connection would capture every other
+    // statement of the client, so grouping needs pooled connections
+    if (args.groupCommit && !args.pool) {
+      throw new SeekdbValueError("groupCommit requires the pool option");
+    }
+    this._groupCommit = args.groupCommit
+      ? new GroupCommitQueue(
+          () => this.beginTransaction(),
+          args.groupCommit === true ? {} : args.groupCommit
+        )
+      : null;
   }
 
   /** Ensure connection; loads addon on first use (may download via js-bindings). Reuses Database by path. */
-  private async _ensureConnection(): Promise<Connection> {
-    if (!this._addon) this._addon = await getNativeAddon();
+  private async _ensureConnection(): Promise<Connection | Pool> {
+    if (!this._addon) {
+      const addon = await getNativeAddon();
+      // Process-wide; throws if another client started it with different options
+      if (this.executorOptions) addon.configure(this.executorOptions);
+      this._addon = addon;
+    }
 
     if (!this._initialized) {
-      let db = _dbCache.get(this.path);
-      if (db === undefined) {
-        try {
-          db = this._addon.open(this.path);
-          _dbCache.set(this.path, db);
-        } catch (error: unknown) {
-          const err = error as { message?: string };
-          if (!err.message?.includes("initialized twice")) {
-            throw error;
-          }
-          db = _dbCache.get(this.path);
-        }
+      let entry = _dbCache.get(this.path);
+      if (entry === undefined) {
+        // Opened on a native worker so a cold start does not block the event loop;
+        // joins the engine if another worker thread already opened this path
+        const db = this._addon.open_async(this.path);
+        entry = { db, users: 0 };
+        _dbCache.set(this.path, entry);
+        db.catch(() => _dbCache.delete(this.path));
+      }
+      const db = await entry.db;
+      if (!this._initialized) {
+        entry.users++;
+        this._db = db;
+        this._initialized = true;
       }
-      this._db = db ?? null;
-      this._initialized = true;
     }
 
     if (this._connection === null) {
       if (!this._db) {
         throw new Error("Database not initialized");
       }
-      this._connection = this._addon.connect(this._db, this.database, true);
+      if (this.poolOptions) {
+        // Each pooled connection runs the session defaults when it is opened (errors ignored natively).
+        this._pool = this._addon.create_pool(this._db, this.database, true, {
+          ...this.poolOptions,
+          initSql: SESSION_INIT_SQL,
+        });
+        this._connection = this._pool;
+        return this._connection;
+      }
+      const connection = this._addon.connect(this._db, this.database, true);
+      this._connection = connection;
       // Auto-set session defaults so 100KB+ documents work without user config (align with server behavior).
       try {
-        await this._addon.execute(
-          this._connection,
-          "SET SESSION ob_default_lob_inrow_threshold = 262144",
-          undefined
-        );
-        await this._addon.execute(
-          this._connection,
-          "SET SESSION max_allowed_packet = 2097152",
-          undefined
+        await this._addon.execute_batch(
+          connection,
+          SESSION_INIT_SQL.map((sql) => ({ sql }))
         );
       } catch {
         // Ignore if backend does not support these (e.g. older version); 100KB may still work with table default.
@@ -74,30 +174,303 @@ export class InternalEmbeddedClient implements IInternalClient {
     return this._connection !== null && this._initialized;
   }
 
+  /**
+   * Load the addon, open the database and connect ahead of the first query; a pool
+   * opens up to connections (default max) connections with the session defaults applied
+   */
+  async warmup(connections?: number): Promise<void> {
+    await this._ensureConnection();
+    if (this._pool) {
+      await this._addon!.warm_pool(
+        this._pool,
+        connections ?? this.poolOptions?.max ?? 4
+      );
+    }
+  }
+
   async execute(
     sql: string,
-    params?: unknown[]
+    params?: unknown[],
+    options?: InternalExecuteOptions
   ): Promise<RowDataPacket[] | null> {
-    const conn = await this._ensureConnection();
+    if (
+      this._groupCommit &&
+      !options?.signal &&
+      options?.timeoutMs === undefined &&
+      GROUPABLE_WRITE.test(sql)
+    ) {
+      return this._groupCommit.run((tx) =>
+        tx
+          ? tx.execute(sql, params, options)
+          : this._execute(null, sql, params, options)
+      );
+    }
+    return this._execute(null, sql, params, options);
+  }
+
+  // execute() on the connection or pool, or on tx
+  private async _execute(
+    tx: Transaction | null,
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowDataPacket[] | null> {
+    const conn: TargetHandle = tx ?? (await this._ensureConnection());
     const addon = this._addon!;
-    const result = await addon.execute(conn, sql, params);
+    const timing = queryChannel.hasSubscribers;
+    const result = await addon.execute(conn, sql, params, {
+      ...options,
+      ...ROW_MODE,
+      maxResultBytes: options?.maxResultBytes ?? this._maxResultBytes,
+      timing,
+    });
+    if (timing && result?.timing) {
+      const message: { sql: string; timing: EmbeddedQueryTiming } = {
+        sql,
+        timing: result.timing,
+      };
+      queryChannel.publish(message);
+    }
 
     if (!result || !result.rows) {
       return null;
     }
+    return result.rows as RowDataPacket[];
+  }
 
-    const columns = result.columns || [];
-    const rows: RowDataPacket[] = [];
-    for (const row of result.rows) {
-      const rowObj: RowDataPacket = {} as RowDataPacket;
-      for (let i = 0; i < columns.length && i < row.length; i++)
-        rowObj[columns[i]] = row[i];
-      rows.push(rowObj);
+  /**
+   * execute() with array rows and SeekdbField metadata straight from the
+   * native result, skipping the per-row objects. Never grouped.
+   */
+  async executeRows(
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowArrayResult> {
+    return this._executeRows(null, sql, params, options);
+  }
+
+  private async _executeRows(
+    tx: Transaction | null,
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowArrayResult> {
+    const conn: TargetHandle = tx ?? (await this._ensureConnection());
+    const result = await this._addon!.execute(conn, sql, params, {
+      ...options,
+      rowMode: "array",
+      fields: true,
+      maxResultBytes: options?.maxResultBytes ?? this._maxResultBytes,
+    });
+    return {
+      columns: result?.columns ?? [],
+      fields: result?.fields ?? [],
+      rows: (result?.rows ?? []) as unknown[][],
+    };
+  }
+
+  /** Run statements sequentially on one native worker (optionally in a transaction). */
+  async executeBatch(
+    statements: BatchStatement[],
+    options?: ExecuteBatchOptions
+  ): Promise<(RowDataPacket[] | null)[]> {
+    return this._executeBatch(null, statements, options);
+  }
+
+  private async _executeBatch(
+    tx: Transaction | null,
+    statements: BatchStatement[],
+    options?: ExecuteBatchOptions
+  ): Promise<(RowDataPacket[] | null)[]> {
+    const conn: TargetHandle = tx ?? (await this._ensureConnection());
+    const results = await this._addon!.execute_batch(conn, statements, {
+      ...options,
+      ...ROW_MODE,
+      maxResultBytes: options?.maxResultBytes ?? this._maxResultBytes,
+    });
+    return results.map((result) =>
+      result?.rows ? (result.rows as RowDataPacket[]) : null
+    );
+  }
+
+  /**
+   * Run independent statements concurrently: a pool splits them over up to
+   * max connections, one native batch each; a single connection runs one batch
+   */
+  async executeMany(
+    statements: BatchStatement[],
+    options?: InternalExecuteOptions
+  ): Promise<(RowDataPacket[] | null)[]> {
+    await this._ensureConnection();
+    // Native pools default to 4 connections
+    const lanes = this._pool
+      ? Math.min(this.poolOptions?.max ?? 4, statements.length)
+      : 1;
+    if (lanes <= 1) return this.executeBatch(statements, options);
+    const size = Math.ceil(statements.length / lanes);
+    const batches: BatchStatement[][] = [];
+    for (let i = 0; i < statements.length; i += size) {
+      batches.push(statements.slice(i, i + size));
+    }
+    const results = await Promise.all(
+      batches.map((batch) => this.executeBatch(batch, options))
+    );
+    return results.flat();
+  }
+
+  /**
+   * Hybrid search in one native hop (SET @search_parm, GET_SQL, validation and
+   * the query itself); cached templates skip straight to the query
+   */
+  async hybridSearch(
+    table: string,
+    searchParm: object
+  ): Promise<RowDataPacket[] | null> {
+    const cached = this._hybridSqlCache?.get(table, searchParm);
+    if (cached) return (await this.execute(cached)) ?? [];
+
+    const conn = await this._ensureConnection();
+    const addon = this._addon!;
+    const result = await addon.hybrid_search(
+      conn,
+      table,
+      JSON.stringify(searchParm),
+      { ...ROW_MODE, maxResultBytes: this._maxResultBytes }
+    );
+    if (!result.sql) return null;
+    if (this._hybridSqlCache) {
+      await this._hybridSqlCache.learn(
+        table,
+        searchParm,
+        result.sql,
+        async (parm) => {
+          const generated = await addon.hybrid_search(
+            conn,
+            table,
+            JSON.stringify(parm),
+            { generateOnly: true }
+          );
+          return generated.sql;
+        }
+      );
     }
-    return rows;
+    return result.rows as RowDataPacket[];
+  }
+
+  /** Insert column-major data; the native side issues chunked multi-row INSERTs on one worker. */
+  async bulkInsert(
+    table: string,
+    columns: BulkInsertColumn[],
+    data: unknown[][],
+    options?: BulkInsertOptions
+  ): Promise<number> {
+    const rows = data[0]?.length ?? 0;
+    // A multi-statement transactional insert must stay all-or-nothing on its own
+    const single =
+      !options?.transactional ||
+      rows <= (options.chunkSize ?? DEFAULT_BULK_CHUNK_SIZE);
+    if (this._groupCommit && single) {
+      return this._groupCommit.run((tx) =>
+        tx
+          ? tx.bulkInsert(table, columns, data, options)
+          : this._bulkInsert(null, table, columns, data, options)
+      );
+    }
+    return this._bulkInsert(null, table, columns, data, options);
+  }
+
+  private async _bulkInsert(
+    tx: Transaction | null,
+    table: string,
+    columns: BulkInsertColumn[],
+    data: unknown[][],
+    options?: BulkInsertOptions
+  ): Promise<number> {
+    const conn: TargetHandle = tx ?? (await this._ensureConnection());
+    return this._addon!.bulk_insert(conn, table, columns, data, options);
+  }
+
+  /**
+   * Start a transaction: a pool pins one of its connections until commit() or
+   * rollback(); a single connection runs it on itself, so statements issued on
+   * the client meanwhile join it
+   */
+  async beginTransaction(): Promise<EmbeddedTransaction> {
+    const conn = await this._ensureConnection();
+    const addon = this._addon!;
+    const tx = await addon.begin(conn);
+    return {
+      execute: (sql, params, options) =>
+        this._execute(tx, sql, params, options),
+      executeBatch: (statements, options) =>
+        this._executeBatch(tx, statements, options),
+      executeRows: (sql, params, options) =>
+        this._executeRows(tx, sql, params, options),
+      bulkInsert: (table, columns, data, options) =>
+        this._bulkInsert(tx, table, columns, data, options),
+      commit: () => addon.commit(tx),
+      rollback: () => addon.rollback(tx),
+    };
+  }
+
+  /** Stream rows through a native cursor; each batch is fetched and decoded on a worker. */
+  async *executeStream(
+    sql: string,
+    params?: unknown[],
+    options?: ExecuteStreamOptions
+  ): AsyncGenerator<RowDataPacket[]> {
+    const conn = await this._ensureConnection();
+    const addon = this._addon!;
+    const cursor = await addon.execute_stream(conn, sql, params, {
+      ...options,
+      ...ROW_MODE,
+      maxResultBytes: options?.maxResultBytes ?? this._maxResultBytes,
+    });
+    try {
+      while (true) {
+        const batch = await addon.fetch_next(cursor);
+        if (!batch.rows.length) return;
+        yield batch.rows as RowDataPacket[];
+      }
+    } finally {
+      addon.close_cursor(cursor);
+    }
+  }
+
+  /** Cumulative execute() statistics of the connection or pool, or null when not yet connected */
+  queryStats(reset?: boolean): EmbeddedQueryStats | null {
+    return this._connection ? this._addon!.stats(this._connection, reset) : null;
+  }
+
+  /** Connection pool statistics, or null when the client is not pooled or not yet connected */
+  poolStats(): EmbeddedPoolStats | null {
+    return this._pool ? this._addon!.pool_stats(this._pool) : null;
   }
 
   async close(): Promise<void> {
-    // No-op (embedded DB is process-local; close_sync would block event loop)
+    // No-op (embedded DB is process-local; see shutdown() to release it)
+  }
+
+  /**
+   * Disconnect and release this client's use of the database. The last client of the
+   * thread releases its handle with close_async, off the event loop; the engine shuts
+   * down once no thread in the process still uses it.
+   */
+  async shutdown(): Promise<void> {
+    const addon = this._addon;
+    if (!addon || !this._initialized) return;
+    if (this._pool) addon.close_pool(this._pool);
+    else if (this._connection) addon.disconnect(this._connection as Connection);
+    this._connection = null;
+    this._pool = null;
+    this._db = null;
+    this._initialized = false;
+
+    const entry = _dbCache.get(this.path);
+    if (entry && --entry.users === 0) {
+      _dbCache.delete(this.path);
+      await addon.close_async(await entry.db);
+    }
   }
 }
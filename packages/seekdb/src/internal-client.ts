@@ -1,6 +1,6 @@
 import { Connection } from "./connection.js";
 import type { RowDataPacket } from "mysql2/promise";
-import type { SeekdbClientArgs } from "./types.js";
+import type { SeekdbClientArgs, InternalExecuteOptions } from "./types.js";
 import {
   DEFAULT_TENANT,
   DEFAULT_DATABASE,
@@ -49,9 +49,12 @@ export class InternalClient implements IInternalClient {
 
   async execute(
     sql: string,
-    params?: unknown[]
+    params?: unknown[],
+    options?: InternalExecuteOptions
   ): Promise<RowDataPacket[] | null> {
-    return this.connectionManager.execute(sql, params);
+    // mysql2 cannot cancel a sent query; only an already aborted signal is honored
+    options?.signal?.throwIfAborted();
+    return this.connectionManager.execute(sql, params, options?.timeoutMs);
   }
 
   async close(): Promise<void> {
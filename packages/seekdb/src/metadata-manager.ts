@@ -3,16 +3,11 @@
  * This table stores collection metadata for v2 collections
  */
 import type { IInternalClient, CollectionMetadata } from "./types.js";
+import { executeBatch } from "./utils.js";
 
 export const METADATA_TABLE_NAME = "sdk_collections";
 
-/**
- * Ensure metadata table exists, create if not
- */
-export async function ensureMetadataTable(
-  client: IInternalClient
-): Promise<void> {
-  const createTableSql = `
+const CREATE_METADATA_TABLE_SQL = `
     CREATE TABLE IF NOT EXISTS ${METADATA_TABLE_NAME} (
       collection_id CHAR(32) PRIMARY KEY DEFAULT (replace(uuid(), '-', '')),
       collection_name STRING,
@@ -23,8 +18,14 @@ export async function ensureMetadataTable(
     ) COMMENT='Settings of collections created by SDK'
   `;
 
+/**
+ * Ensure metadata table exists, create if not
+ */
+export async function ensureMetadataTable(
+  client: IInternalClient
+): Promise<void> {
   try {
-    await client.execute(createTableSql);
+    await client.execute(CREATE_METADATA_TABLE_SQL);
   } catch (error) {
     throw new Error(
       `Failed to create metadata table: ${error instanceof Error ? error.message : String(error)}`
@@ -40,29 +41,29 @@ export async function insertCollectionMetadata(
   collectionName: string,
   settings: CollectionMetadata["settings"]
 ): Promise<string> {
-  // Ensure metadata table exists
-  await ensureMetadataTable(client);
-
   // Insert metadata record
   const insertSql = `
     INSERT INTO ${METADATA_TABLE_NAME} (collection_name, settings)
     VALUES (?, ?)
   `;
 
+  // Query the collection_id of the just-inserted record
+  const selectSql = `
+    SELECT collection_id
+    FROM ${METADATA_TABLE_NAME}
+    WHERE collection_name = ?
+    ORDER BY created_at DESC
+    LIMIT 1
+  `;
+
   try {
     const settingsJson = JSON.stringify({ ...settings, version: "v2" });
-    await client.execute(insertSql, [collectionName, settingsJson]);
-
-    // Query the collection_id of the just-inserted record
-    const selectSql = `
-      SELECT collection_id
-      FROM ${METADATA_TABLE_NAME}
-      WHERE collection_name = ?
-      ORDER BY created_at DESC
-      LIMIT 1
-    `;
-
-    const result = await client.execute(selectSql, [collectionName]);
+    // Ensure table, insert and read back the id in one round trip
+    const [, , result] = await executeBatch(client, [
+      { sql: CREATE_METADATA_TABLE_SQL },
+      { sql: insertSql, params: [collectionName, settingsJson] },
+      { sql: selectSql, params: [collectionName] },
+    ]);
 
     if (!result || result.length === 0) {
       throw new Error(
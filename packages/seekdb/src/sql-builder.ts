@@ -8,6 +8,7 @@ import {
   CollectionFieldNames,
   DEFAULT_DISTANCE_METRIC,
   vectorToSqlString,
+  vectorToFloat32Array,
   serializeMetadata,
   serializeSparseVector,
 } from "./utils.js";
@@ -21,6 +22,7 @@ import type {
   FulltextAnalyzerConfig,
   HnswParams,
   SQLResult,
+  BulkInsertData,
   SparseVectorIndexConfigOptions,
 } from "./types.js";
 import { Schema } from "./schema.js";
@@ -124,6 +126,25 @@ export class SQLBuilder {
     return `WITH(${parts.join(", ")})`;
   }
 
+  /**
+   * Vector bind param in the client's format (see CollectionContext.vectorFormat)
+   */
+  private static vectorParam(
+    context: CollectionContext,
+    vector: number[]
+  ): string | Float32Array {
+    return context.vectorFormat === "float32"
+      ? vectorToFloat32Array(vector)
+      : vectorToSqlString(vector);
+  }
+
+  private static sparseParam(
+    sparse: Record<number, number> | string | null | undefined
+  ): string | null {
+    if (sparse == null) return null;
+    return typeof sparse === "string" ? sparse : serializeSparseVector(sparse);
+  }
+
   /**
    * Build fulltext clause for CREATE TABLE
    */
@@ -200,7 +221,8 @@ export class SQLBuilder {
     data: {
       ids: string[];
       documents?: (string | null)[];
-      embeddings: number[][];
+      /** Omitted only by upserts of rows that all exist already */
+      embeddings?: number[][];
       sparseEmbeddings?: (Record<number, number> | string | null)[];
       metadatas?: (Metadata | null)[];
     }
@@ -212,49 +234,122 @@ export class SQLBuilder {
     const valuesList: string[] = [];
     const params: unknown[] = [];
     const numItems = data.ids.length;
+    const embeddings = data.embeddings;
     const hasSparse = Array.isArray(data.sparseEmbeddings);
 
+    const columns: string[] = [
+      CollectionFieldNames.ID,
+      CollectionFieldNames.DOCUMENT,
+      CollectionFieldNames.METADATA,
+    ];
+    if (embeddings) columns.push(CollectionFieldNames.EMBEDDING);
+    if (hasSparse) columns.push(CollectionFieldNames.SPARSE_EMBEDDING);
+    const rowSql = `(CAST(? AS BINARY)${", ?".repeat(columns.length - 1)})`;
+
     for (let i = 0; i < numItems; i++) {
       const id = data.ids[i];
       const doc = data.documents?.[i] ?? null;
       const meta = data.metadatas?.[i] ?? null;
-      const vec = data.embeddings[i];
       const sparse = data.sparseEmbeddings?.[i] ?? null;
 
-      valuesList.push(
-        hasSparse
-          ? `(CAST(? AS BINARY), ?, ?, ?, ?)`
-          : `(CAST(? AS BINARY), ?, ?, ?)`
-      );
-      params.push(
-        id,
-        doc,
-        meta ? serializeMetadata(meta) : null,
-        vectorToSqlString(vec)
-      );
-      if (hasSparse) {
-        const sparseValue =
-          sparse == null
-            ? null
-            : typeof sparse === "string"
-              ? sparse
-              : serializeSparseVector(sparse);
-        params.push(sparseValue);
+      valuesList.push(rowSql);
+      params.push(id, doc, meta ? serializeMetadata(meta) : null);
+      if (embeddings) {
+        params.push(SQLBuilder.vectorParam(context, embeddings[i]));
       }
+      if (hasSparse) params.push(SQLBuilder.sparseParam(sparse));
     }
 
-    const columns = [
-      CollectionFieldNames.ID,
-      CollectionFieldNames.DOCUMENT,
-      CollectionFieldNames.METADATA,
-      CollectionFieldNames.EMBEDDING,
-    ];
-
-    if (hasSparse) columns.push(CollectionFieldNames.SPARSE_EMBEDDING);
     const sql = `INSERT INTO \`${tableName}\` (${columns.join(", ")}) VALUES ${valuesList.join(", ")}`;
     return { sql, params };
   }
 
+  /**
+   * Build the same insert as buildInsert() in column-major form for
+   * IInternalClient.bulkInsert(), which chunks it natively
+   */
+  static buildBulkInsert(
+    context: CollectionContext,
+    data: {
+      ids: string[];
+      documents?: (string | null)[];
+      embeddings?: number[][];
+      sparseEmbeddings?: (Record<number, number> | string | null)[];
+      metadatas?: (Metadata | null)[];
+    }
+  ): BulkInsertData {
+    const table = CollectionNames.tableName(
+      context.name,
+      context.collectionId
+    );
+    const numItems = data.ids.length;
+    const documents = new Array<string | null>(numItems);
+    const metadatas = new Array<string | null>(numItems);
+    for (let i = 0; i < numItems; i++) {
+      const meta = data.metadatas?.[i] ?? null;
+      documents[i] = data.documents?.[i] ?? null;
+      metadatas[i] = meta ? serializeMetadata(meta) : null;
+    }
+
+    const result: BulkInsertData = {
+      table,
+      columns: [
+        { name: CollectionFieldNames.ID, binaryId: true },
+        { name: CollectionFieldNames.DOCUMENT },
+        { name: CollectionFieldNames.METADATA },
+      ],
+      data: [data.ids, documents, metadatas],
+    };
+    if (data.embeddings) {
+      const embeddings = data.embeddings;
+      result.columns.push({ name: CollectionFieldNames.EMBEDDING });
+      result.data.push(
+        embeddings.map((vec) => SQLBuilder.vectorParam(context, vec))
+      );
+    }
+    if (Array.isArray(data.sparseEmbeddings)) {
+      const sparseEmbeddings = data.sparseEmbeddings;
+      result.columns.push({ name: CollectionFieldNames.SPARSE_EMBEDDING });
+      result.data.push(
+        data.ids.map((_, i) => SQLBuilder.sparseParam(sparseEmbeddings[i]))
+      );
+    }
+    return result;
+  }
+
+  /**
+   * Build a multi-row upsert: buildInsert() plus ON DUPLICATE KEY UPDATE
+   * for updateColumns, so existing rows keep every other column
+   */
+  static buildUpsert(
+    context: CollectionContext,
+    data: Parameters<typeof SQLBuilder.buildInsert>[1],
+    updateColumns: string[]
+  ): SQLResult {
+    const { sql, params } = SQLBuilder.buildInsert(context, data);
+    const assignments = updateColumns.map((c) => `${c} = VALUES(${c})`);
+    return {
+      sql: `${sql} ON DUPLICATE KEY UPDATE ${assignments.join(", ")}`,
+      params,
+    };
+  }
+
+  /**
+   * Build the same upsert as buildUpsert() in column-major form for
+   * IInternalClient.bulkInsert(); updateColumns are flagged update
+   */
+  static buildBulkUpsert(
+    context: CollectionContext,
+    data: Parameters<typeof SQLBuilder.buildBulkInsert>[1],
+    updateColumns: string[]
+  ): BulkInsertData {
+    const result = SQLBuilder.buildBulkInsert(context, data);
+    for (const column of result.columns) {
+      if (updateColumns.includes(column.name)) column.update = true;
+    }
+    return result;
+  }
+
   /**
    * Build SELECT SQL for getting data
    */
@@ -390,7 +485,7 @@ export class SQLBuilder {
 
     if (updates.embedding !== undefined) {
       setClauses.push(`${CollectionFieldNames.EMBEDDING} = ?`);
-      params.push(vectorToSqlString(updates.embedding));
+      params.push(SQLBuilder.vectorParam(context, updates.embedding));
     }
 
     if (updates.sparseEmbedding !== undefined) {
@@ -101,21 +101,204 @@ export type DistanceMetric = "l2" | "cosine" | "inner_product";
  * Internal client interface - implemented by both InternalClient and InternalEmbeddedClient
  */
 export interface IInternalClient {
+  /** True if execute() accepts Float32Array VECTOR params and honors vectorFormat "float32" */
+  readonly supportsFloat32Vectors?: boolean;
   isConnected(): boolean;
-  execute(sql: string, params?: unknown[]): Promise<RowDataPacket[] | null>;
+  execute(
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowDataPacket[] | null>;
+  /** Stream rows in batches; clients without native cursors may omit this */
+  executeStream?(
+    sql: string,
+    params?: unknown[],
+    options?: ExecuteStreamOptions
+  ): AsyncGenerator<RowDataPacket[]>;
+  /** execute() returning array rows and column metadata; see executeRows() in utils for the fallback */
+  executeRows?(
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowArrayResult>;
+  /** Run statements in order in one round trip; see executeBatch() in utils for the fallback */
+  executeBatch?(
+    statements: BatchStatement[],
+    options?: ExecuteBatchOptions
+  ): Promise<(RowDataPacket[] | null)[]>;
+  /** Run independent reads concurrently; see executeMany() in utils for the fallback */
+  executeMany?(
+    statements: BatchStatement[],
+    options?: InternalExecuteOptions
+  ): Promise<(RowDataPacket[] | null)[]>;
+  /**
+   * Run a hybrid search for search_parm in one call; resolves with null when
+   * DBMS_HYBRID_SEARCH.GET_SQL returns no SQL. Collection.hybridSearch() falls
+   * back to SET + GET_SQL + execute() when omitted.
+   */
+  hybridSearch?(
+    table: string,
+    searchParm: object
+  ): Promise<RowDataPacket[] | null>;
+  /** Insert column-major data in chunked multi-row INSERTs; resolves with the row count */
+  bulkInsert?(
+    table: string,
+    columns: BulkInsertColumn[],
+    data: unknown[][],
+    options?: BulkInsertOptions
+  ): Promise<number>;
+  /**
+   * Load everything the first query needs (addon, database, session defaults) and open
+   * up to connections pooled connections; BaseSeekdbClient.warmup() runs SELECT 1 when omitted
+   */
+  warmup?(connections?: number): Promise<void>;
+  /** Start an explicit transaction; see beginTransaction() in utils for the fallback */
+  beginTransaction?(): Promise<SeekdbTransaction>;
   close(): Promise<void>;
 }
 
+/**
+ * Explicit transaction from beginTransaction(): its statements run on one
+ * connection (embedded pools pin a connection) until commit() or rollback()
+ */
+export interface SeekdbTransaction {
+  execute(
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowDataPacket[] | null>;
+  /** Run statements in order; options.transactional is ignored (already in one) */
+  executeBatch(
+    statements: BatchStatement[],
+    options?: ExecuteBatchOptions
+  ): Promise<(RowDataPacket[] | null)[]>;
+  /** execute() returning rows as arrays with column metadata, see RowArrayResult */
+  executeRows(
+    sql: string,
+    params?: unknown[],
+    options?: InternalExecuteOptions
+  ): Promise<RowArrayResult>;
+  /** Commit; a failed commit is rolled back and rethrown */
+  commit(): Promise<void>;
+  rollback(): Promise<void>;
+}
+
+/**
+ * Column metadata of a RowArrayResult, from the engine's field information. type is the
+ * seekdb field type code (TINY=1, SHORT=2, LONG=3, LONGLONG=4, FLOAT=5, DOUBLE=6, STRING=11,
+ * BLOB=12, VECTOR=40), or null when the engine reported none.
+ */
+export interface ResultField {
+  name: string;
+  type: number | null;
+  length: number;
+  flags: number;
+}
+
+/**
+ * Result of executeRows(): rows as value arrays in column order, without per-row objects.
+ * fields is present in embedded mode (also for empty results).
+ */
+export interface RowArrayResult {
+  columns: string[];
+  fields?: ResultField[];
+  rows: unknown[][];
+}
+
+/** One entry of an executeBatch() call */
+export interface BatchStatement {
+  sql: string;
+  params?: unknown[];
+}
+
+/**
+ * Options for executeBatch()
+ */
+export interface ExecuteBatchOptions extends InternalExecuteOptions {
+  /** Wrap the statements in BEGIN/COMMIT and roll back on the first failure */
+  transactional?: boolean;
+}
+
+/**
+ * Per-call options for IInternalClient.execute(); clients ignore options they do not support
+ */
+export interface InternalExecuteOptions {
+  /** Return VECTOR columns as Float32Array instead of JSON strings */
+  vectorFormat?: "string" | "float32";
+  /** Columns to return parsed from JSON text (server mode already parses JSON columns) */
+  jsonColumns?: string[];
+  /**
+   * Abort the statement: embedded mode kills the running query and rejects with an
+   * AbortError; server mode only checks the signal before sending the query. Embedded mode
+   * requires the pool option (or a transaction of a pooled client), since the kill acts on
+   * the whole session.
+   */
+  signal?: AbortSignal;
+  /**
+   * Per-statement timeout in milliseconds (embedded: ob_query_timeout, pooled clients only;
+   * server: mysql2 timeout)
+   */
+  timeoutMs?: number;
+  /**
+   * Embedded mode only: reject a result that decodes to more than this many bytes instead of
+   * materializing it; executeStream() ends each batch there. Defaults to the client's
+   * maxResultBytes.
+   */
+  maxResultBytes?: number;
+  /**
+   * Embedded mode only: return text/VECTOR cells of at least this many bytes as LazyCell,
+   * decoded into a JS value only when read() (and not JSON-parsed)
+   */
+  lazyColumns?: number;
+}
+
+/**
+ * Options for executeStream()
+ */
+export interface ExecuteStreamOptions extends InternalExecuteOptions {
+  /** Rows per yielded batch (default 1000) */
+  batchSize?: number;
+}
+
 export interface SQLResult {
   sql: string;
   params: unknown[];
 }
 
+/** Column of a bulkInsert() call */
+export interface BulkInsertColumn {
+  name: string;
+  /** Bind as CAST(? AS BINARY) (the collection _id column) */
+  binaryId?: boolean;
+  /** Overwrite on duplicate key: the insert becomes an upsert */
+  update?: boolean;
+}
+
+/**
+ * Options for bulkInsert()
+ */
+export interface BulkInsertOptions {
+  /** Rows per INSERT statement (default 1000) */
+  chunkSize?: number;
+  /** Wrap all chunks in BEGIN/COMMIT and roll back on the first failure */
+  transactional?: boolean;
+}
+
+/** Column-major INSERT produced by SQLBuilder.buildBulkInsert() */
+export interface BulkInsertData {
+  table: string;
+  columns: BulkInsertColumn[];
+  /** One array per column, all of the same length */
+  data: unknown[][];
+}
+
 export interface CollectionContext {
   name: string;
   collectionId?: string;
   dimension?: number;
   distance?: DistanceMetric;
+  /** How vector params are passed to the client (default "string") */
+  vectorFormat?: "string" | "float32";
 }
 
 export interface CollectionConfig {
@@ -260,6 +443,159 @@ export interface SeekdbClientArgs {
   charset?: string;
   /** Optional OceanBase/seekdb query timeout in milliseconds. */
   queryTimeout?: number;
+  /** Embedded mode only: run queries on a native connection pool instead of one connection. */
+  pool?: EmbeddedPoolOptions;
+  /** Embedded mode only: run queries on a dedicated native thread pool instead of libuv's. */
+  executor?: EmbeddedExecutorOptions;
+  /**
+   * Embedded mode only: cache up to this many hybrid search SQL templates keyed on the
+   * search_parm shape, so repeated searches skip DBMS_HYBRID_SEARCH.GET_SQL (default 0: off)
+   */
+  hybridSearchCache?: number;
+  /**
+   * Reuse collections resolved by getCollection() for this many milliseconds, skipping the
+   * metadata queries (default 0: off). createCollection, deleteCollection and fork through
+   * this client invalidate entries; changes made elsewhere show up once an entry expires.
+   */
+  collectionCacheTtl?: number;
+  /**
+   * Embedded mode only: merge concurrent autocommit writes (INSERT, UPDATE, DELETE and
+   * REPLACE through execute(), single-statement bulk inserts) into one transaction per
+   * group, so they share one commit. true uses the default GroupCommitOptions.
+   * Requires pool: each group's transaction runs on its own pooled connection.
+   */
+  groupCommit?: boolean | GroupCommitOptions;
+  /**
+   * Embedded mode only: default InternalExecuteOptions.maxResultBytes, so an unbounded
+   * Collection.get() or query fails with an error naming the budget instead of exhausting
+   * memory (default: unlimited)
+   */
+  maxResultBytes?: number;
+}
+
+/**
+ * Options for client.warmup()
+ */
+export interface WarmupOptions {
+  /** Collections to resolve and read once (metadata, statement analysis, table data) */
+  collections?: string[];
+  /** Also run one vector query per collection so its HNSW index is loaded (default true) */
+  preloadIndexes?: boolean;
+  /** Embedded pools: connections to open up front (default: the pool's max) */
+  connections?: number;
+}
+
+/**
+ * Embedded group commit options. Writes issued while a group commits wait for the
+ * next group; a write that is alone when its group starts runs in autocommit. If any
+ * write of a group or its commit fails, the group is rolled back and its writes run
+ * again one by one, so each caller sees only its own error. Without a pool the group's
+ * transaction runs on the client's only connection, so reads issued meanwhile see its
+ * uncommitted writes.
+ */
+export interface GroupCommitOptions {
+  /** Writes per group (default 64) */
+  maxStatements?: number;
+  /** How long a group collects writes before it starts (default 0: same event loop turn) */
+  maxDelayMs?: number;
+}
+
+/**
+ * Embedded native executor options. The executor is process-wide: every embedded client
+ * must pass the same options (or none), and they take effect before the first query.
+ */
+export interface EmbeddedExecutorOptions {
+  /** Native query threads (default 4); 0 keeps the libuv threadpool */
+  threads?: number;
+  /** Queries that may wait for a thread before further ones reject (default 1024) */
+  queueDepth?: number;
+}
+
+/**
+ * Embedded connection pool options. Each in-flight query leases its own connection,
+ * so independent queries run in parallel; session state (SET, user variables) is per
+ * connection and does not carry over between execute() calls.
+ */
+export interface EmbeddedPoolOptions {
+  /** Connections opened up front and kept open (default 0) */
+  min?: number;
+  /** Upper bound on open connections; further queries wait (default 4) */
+  max?: number;
+  /** Idle time after which connections above min are closed (default 60000) */
+  idleTimeoutMs?: number;
+}
+
+/** Snapshot of embedded connection pool usage */
+export interface EmbeddedPoolStats {
+  total: number;
+  idle: number;
+  inUse: number;
+  /** Queries currently waiting for a connection */
+  waiters: number;
+  created: number;
+  acquired: number;
+  /** Acquires that had to wait */
+  waited: number;
+  totalWaitMs: number;
+  maxWaitMs: number;
+}
+
+/** Latency histogram of EmbeddedQueryStats: buckets[i] counts samples below bucketBoundsMs[i] */
+export interface EmbeddedLatencyHistogram {
+  count: number;
+  totalMs: number;
+  maxMs: number;
+  p50Ms: number;
+  p95Ms: number;
+  p99Ms: number;
+  buckets: number[];
+}
+
+/** Cumulative embedded execute() statistics, split by where the time went */
+export interface EmbeddedQueryStats {
+  queries: number;
+  errors: number;
+  rows: number;
+  /** String/VECTOR cell bytes decoded */
+  bytes: number;
+  /** 2MB re-reads of NULL/unknown-length cells */
+  fallbackReads: number;
+  /** Waiting for a native worker and a connection */
+  queue: EmbeddedLatencyHistogram;
+  /** Statement execution in the engine */
+  engine: EmbeddedLatencyHistogram;
+  /** Row fetch and decode */
+  fetch: EmbeddedLatencyHistogram;
+  /** Building JS rows */
+  materialize: EmbeddedLatencyHistogram;
+  total: EmbeddedLatencyHistogram;
+  bucketBoundsMs: number[];
+}
+
+/**
+ * Timing of one embedded execute(), published on the "seekdb:query" diagnostics_channel
+ * as { sql, timing } while the channel has subscribers
+ */
+export interface EmbeddedQueryTiming {
+  queueMs: number;
+  engineMs: number;
+  fetchMs: number;
+  materializeMs: number;
+  totalMs: number;
+  rows: number;
+  bytes: number;
+  fallbackReads: number;
+}
+
+/**
+ * Text or VECTOR cell returned in place of its value when executed with lazyColumns
+ * (embedded mode); the JS string or Float32Array is only built by read()
+ */
+export interface LazyCell {
+  /** Payload size in bytes */
+  byteLength: number;
+  /** Decode the cell; maxBytes cuts a string at the last whole UTF-8 character */
+  read(maxBytes?: number): string | Float32Array;
 }
 
 export interface SeekdbAdminClientArgs {
@@ -297,6 +633,31 @@ export interface AddOptions {
   documents?: string | string[];
 }
 
+/** One record of Collection.addStream() */
+export interface AddStreamRecord {
+  id: string;
+  /** Generated from document by the collection's embedding function when omitted */
+  embedding?: number[];
+  document?: string | null;
+  metadata?: Metadata | null;
+}
+
+export interface AddStreamOptions {
+  /** Records per embedding request and INSERT (default 500) */
+  chunkSize?: number;
+  /** Chunks embedded or waiting to be inserted at once (default 4) */
+  concurrency?: number;
+  /** Called after each chunk has been inserted */
+  onProgress?: (progress: AddStreamResult) => void;
+}
+
+export interface AddStreamResult {
+  /** Records inserted */
+  inserted: number;
+  /** Chunks inserted */
+  chunks: number;
+}
+
 export interface UpdateOptions {
   ids: string | string[];
   embeddings?: number[] | number[][];
@@ -391,10 +752,20 @@ export interface EmbeddingFunction {
   dimension?: number;
 }
 
+export interface EmbeddingCacheOptions {
+  /** Vectors kept across all functions sharing the cache (default 10000) */
+  maxEntries?: number;
+}
+
 export interface SparseEmbeddingFunction {
   readonly name: string;
   generate(texts: string[]): Promise<SparseVectors>;
   generateForQueries?(texts: string[]): Promise<SparseVectors>;
+  /**
+   * Serialized sparse vectors ("{id:weight,...}", as serializeSparseVector()) for texts.
+   * Used on ingest instead of generate() when present, skipping the object round trip.
+   */
+  generateSerialized?(texts: string[]): Promise<string[]>;
   getConfig(): EmbeddingConfig;
   validateConfigUpdate?(newConfig: Record<string, unknown>): void;
   dispose?(): Promise<void>;
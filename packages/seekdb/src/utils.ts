@@ -2,12 +2,19 @@
  * Utility functions for seekdb SDK
  */
 
+import type { RowDataPacket } from "mysql2/promise";
 import { SeekdbValueError } from "./errors.js";
 import type {
   Metadata,
   EmbeddingFunction,
   EmbeddingConfig,
   SparseEmbeddingFunction,
+  IInternalClient,
+  BatchStatement,
+  ExecuteBatchOptions,
+  InternalExecuteOptions,
+  RowArrayResult,
+  SeekdbTransaction,
 } from "./types.js";
 import { DistanceMetric } from "./types.js";
 import {
@@ -168,6 +175,44 @@ export function vectorToSqlString(vector: number[]): string {
   return JSON.stringify(vector);
 }
 
+/**
+ * Convert vector array to a Float32Array param (embedded mode binds it as VECTOR natively)
+ */
+export function vectorToFloat32Array(vector: number[]): Float32Array {
+  if (!Array.isArray(vector)) {
+    throw new SeekdbValueError("Vector must be an array");
+  }
+  for (const val of vector) {
+    if (!Number.isFinite(val)) {
+      throw new SeekdbValueError(`Vector contains invalid value: ${val}`);
+    }
+  }
+  return Float32Array.from(vector);
+}
+
+/**
+ * Shortest decimal that reads back as the same float32, matching the text the server
+ * prints for the element (e.g. 1.1 instead of 1.100000023841858)
+ */
+function float32ToNumber(value: number): number {
+  if (!Number.isFinite(value) || Number.isSafeInteger(value)) return value;
+  for (let precision = 1; precision < 9; precision++) {
+    const candidate = Number(value.toPrecision(precision));
+    if (Math.fround(candidate) === value) return candidate;
+  }
+  return Number(value.toPrecision(9));
+}
+
+/**
+ * Convert a VECTOR column value from a result row to number[]
+ * (Float32Array in float32 mode, JSON string otherwise)
+ */
+export function parseVectorValue(value: unknown): number[] | null {
+  if (!value) return null;
+  if (value instanceof Float32Array) return Array.from(value, float32ToNumber);
+  return typeof value === "string" ? JSON.parse(value) : (value as number[]);
+}
+
 export function isSparseVector(
   value: unknown
 ): value is Record<number, number> {
@@ -705,6 +750,99 @@ export function extractTableNamesFromResult(
   return tableNames;
 }
 
+/**
+ * Run statements in order, resolving with one result per statement.
+ * Uses the client's native batch (one worker hop) when available, otherwise one execute() each.
+ */
+export async function executeBatch(
+  client: IInternalClient,
+  statements: BatchStatement[],
+  options: ExecuteBatchOptions = {}
+): Promise<(RowDataPacket[] | null)[]> {
+  if (client.executeBatch) {
+    return client.executeBatch(statements, options);
+  }
+  const results: (RowDataPacket[] | null)[] = [];
+  if (options.transactional) await client.execute("BEGIN");
+  try {
+    for (const { sql, params } of statements) {
+      results.push(await client.execute(sql, params, options));
+    }
+    if (options.transactional) await client.execute("COMMIT");
+  } catch (error) {
+    if (options.transactional) {
+      await client.execute("ROLLBACK").catch(() => undefined);
+    }
+    throw error;
+  }
+  return results;
+}
+
+/**
+ * Execute SQL and resolve with array rows plus column metadata. Uses the
+ * client's native row-array path when available; otherwise object rows are
+ * converted (columns from the first row, no fields, so empty results have
+ * no columns).
+ */
+export async function executeRows(
+  client: Pick<IInternalClient, "execute" | "executeRows">,
+  sql: string,
+  params?: unknown[],
+  options?: InternalExecuteOptions
+): Promise<RowArrayResult> {
+  if (client.executeRows) {
+    return client.executeRows(sql, params, options);
+  }
+  const rows = (await client.execute(sql, params, options)) ?? [];
+  const columns = rows.length ? Object.keys(rows[0]) : [];
+  return {
+    columns,
+    rows: rows.map((row) => columns.map((name) => row[name])),
+  };
+}
+
+/**
+ * Start an explicit transaction. Uses the client's native transactions when
+ * available; otherwise BEGIN/COMMIT/ROLLBACK run through execute() on the
+ * client's connection, which statements issued meanwhile share.
+ */
+export async function beginTransaction(
+  client: IInternalClient
+): Promise<SeekdbTransaction> {
+  if (client.beginTransaction) {
+    return client.beginTransaction();
+  }
+  await client.execute("BEGIN");
+  return {
+    execute: (sql, params, options) => client.execute(sql, params, options),
+    executeBatch: (statements, options) =>
+      executeBatch(client, statements, { ...options, transactional: false }),
+    executeRows: (sql, params, options) =>
+      executeRows(client, sql, params, options),
+    commit: async () => {
+      await client.execute("COMMIT");
+    },
+    rollback: async () => {
+      await client.execute("ROLLBACK");
+    },
+  };
+}
+
+/**
+ * Run independent read statements, resolving with one result per statement.
+ * Uses the client's concurrent path when available, otherwise executeBatch().
+ */
+export async function executeMany(
+  client: IInternalClient,
+  statements: BatchStatement[],
+  options: InternalExecuteOptions = {}
+): Promise<(RowDataPacket[] | null)[]> {
+  if (client.executeMany) {
+    return client.executeMany(statements, options);
+  }
+  return executeBatch(client, statements, options);
+}
+
 /**
  * Query table names using multiple strategies
  * Tries SHOW TABLES LIKE, then SHOW TABLES, then information_schema (if supported)
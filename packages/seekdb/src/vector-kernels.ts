@@ -0,0 +1,141 @@
+/**
+ * Client-side vector math (normalization, rescoring distances) with the
+ * semantics of the distance functions vector queries use. Runs on the native
+ * SIMD kernels once the embedded addon is loaded, in JS otherwise.
+ */
+
+import { SeekdbValueError } from "./errors.js";
+import { getNativeAddonSync } from "./native-addon-loader.js";
+import type { DistanceMetric } from "./types.js";
+
+/** Vectors as arrays, or concatenated in one Float32Array */
+export type VectorBatch = ArrayLike<number>[] | Float32Array;
+
+function nativeKernels() {
+  const addon = getNativeAddonSync();
+  return typeof addon?.vector_distances === "function" ? addon : null;
+}
+
+function checkDimensions(vectors: ArrayLike<number>[], dimension: number) {
+  vectors.forEach((vector, i) => {
+    if (vector.length !== dimension) {
+      throw new SeekdbValueError(
+        `Dimension mismatch at index ${i}. Expected ${dimension}, got ${vector.length}`
+      );
+    }
+  });
+}
+
+function checkBatchLength(vectors: Float32Array, dimension: number) {
+  if (dimension === 0 || vectors.length % dimension !== 0) {
+    throw new SeekdbValueError(
+      `Vector batch of ${vectors.length} values is not a multiple of dimension ${dimension}`
+    );
+  }
+}
+
+function toFloat32(vectors: VectorBatch, dimension: number): Float32Array {
+  if (vectors instanceof Float32Array) {
+    checkBatchLength(vectors, dimension);
+    return vectors;
+  }
+  checkDimensions(vectors, dimension);
+  const out = new Float32Array(vectors.length * dimension);
+  vectors.forEach((vector, i) => out.set(vector, i * dimension));
+  return out;
+}
+
+function rows(vectors: VectorBatch, dimension: number): ArrayLike<number>[] {
+  if (!(vectors instanceof Float32Array)) {
+    checkDimensions(vectors, dimension);
+    return vectors;
+  }
+  checkBatchLength(vectors, dimension);
+  const out: Float32Array[] = [];
+  for (let i = 0; i < vectors.length; i += dimension) {
+    out.push(vectors.subarray(i, i + dimension));
+  }
+  return out;
+}
+
+function dot(a: ArrayLike<number>, b: ArrayLike<number>): number {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) sum += a[i] * b[i];
+  return sum;
+}
+
+/**
+ * Scale each vector to unit L2 norm; zero vectors are returned unchanged.
+ * @param vectors - Vectors of the same dimension
+ */
+export function normalizeVectors(vectors: ArrayLike<number>[]): number[][] {
+  if (vectors.length === 0) return [];
+  const dimension = vectors[0].length;
+  const native = nativeKernels();
+  if (native && dimension > 0) {
+    const data = native.vector_normalize(
+      toFloat32(vectors, dimension),
+      dimension
+    );
+    return rows(data, dimension).map((v) => Array.from(v));
+  }
+  return rows(vectors, dimension).map((vector) => {
+    const norm = Math.sqrt(dot(vector, vector));
+    const values = Array.from(vector);
+    return norm > 0 && Number.isFinite(norm)
+      ? values.map((v) => v / norm)
+      : values;
+  });
+}
+
+/**
+ * Distance from query to each vector, as the engine computes it for the
+ * collection's metric: l2 is the Euclidean distance, cosine is 1 - cos
+ * (NaN when either vector is zero) and inner_product the dot product.
+ * Native results are computed in float32, like VECTOR columns.
+ * @param metric - Distance metric
+ * @param query - Query vector
+ * @param vectors - Candidates, e.g. the embeddings of query() results
+ */
+export function vectorDistances(
+  metric: DistanceMetric,
+  query: ArrayLike<number>,
+  vectors: VectorBatch
+): number[] {
+  const dimension = query.length;
+  if (dimension === 0) {
+    throw new SeekdbValueError("Query vector must not be empty");
+  }
+  const native = nativeKernels();
+  if (native) {
+    return Array.from(
+      native.vector_distances(
+        metric,
+        query instanceof Float32Array ? query : Float32Array.from(query),
+        toFloat32(vectors, dimension)
+      )
+    );
+  }
+
+  const queryNorm = Math.sqrt(dot(query, query));
+  return rows(vectors, dimension).map((vector) => {
+    switch (metric) {
+      case "l2": {
+        let sum = 0;
+        for (let i = 0; i < dimension; i++) {
+          const d = query[i] - vector[i];
+          sum += d * d;
+        }
+        return Math.sqrt(sum);
+      }
+      case "inner_product":
+        return dot(query, vector);
+      case "cosine": {
+        const norms = queryNorm * Math.sqrt(dot(vector, vector));
+        return norms > 0 ? 1 - dot(query, vector) / norms : NaN;
+      }
+      default:
+        throw new SeekdbValueError(`Unsupported distance metric: ${metric}`);
+    }
+  });
+}
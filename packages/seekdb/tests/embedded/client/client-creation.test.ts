@@ -418,5 +418,57 @@ describe("Embedded Mode - Client Creation and Collection Management", () => {
         await client.deleteCollection(collectionName);
       }
     });
+
+    test("collectionCacheTtl reuses collections until invalidated", async () => {
+      const cachedClient = new SeekdbClient({
+        ...TEST_CONFIG,
+        collectionCacheTtl: 60_000,
+      });
+      const collectionName = generateCollectionName("test_cached");
+      try {
+        await cachedClient.createCollection({
+          name: collectionName,
+          configuration: { dimension: DENSE_DIM, distance: "l2" },
+          embeddingFunction: null,
+        });
+
+        const first = await cachedClient.getCollection({
+          name: collectionName,
+        });
+        expect(await cachedClient.getCollection({ name: collectionName })).toBe(
+          first
+        );
+
+        // An override gets its own handle and leaves the cached one alone
+        const ef = new ClientTestDenseEF();
+        const overridden = await cachedClient.getCollection({
+          name: collectionName,
+          embeddingFunction: ef,
+        });
+        expect(overridden.embeddingFunction).toBe(ef);
+        expect(first.embeddingFunction).not.toBe(ef);
+        expect(overridden.dimension).toBe(DENSE_DIM);
+
+        // Changes made by another client show up after invalidation
+        await client.deleteCollection(collectionName);
+        expect(await cachedClient.hasCollection(collectionName)).toBe(true);
+        cachedClient.invalidateCollectionCache(collectionName);
+        expect(await cachedClient.hasCollection(collectionName)).toBe(false);
+
+        // deleteCollection on the caching client drops its entry
+        await cachedClient.createCollection({
+          name: collectionName,
+          configuration: { dimension: DENSE_DIM, distance: "l2" },
+          embeddingFunction: null,
+        });
+        await cachedClient.getCollection({ name: collectionName });
+        await cachedClient.deleteCollection(collectionName);
+        await expect(
+          cachedClient.getCollection({ name: collectionName })
+        ).rejects.toThrow();
+      } finally {
+        await cachedClient.close();
+      }
+    });
   });
 });
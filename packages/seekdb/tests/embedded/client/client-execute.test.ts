@@ -4,12 +4,17 @@
  * - DDL (CREATE TABLE, DROP TABLE)
  * - DML (INSERT, UPDATE, DELETE) with params
  * - SET user variable and session state
+ * - executeStream batching
+ * - executeBatch results and transactional rollback
+ * - queryStats and the seekdb:query diagnostics channel
  * - Hybrid search on SQL-created table (no collection API)
  */
 import { describe, test, expect, beforeAll, afterAll } from "vitest";
+import { subscribe, unsubscribe } from "node:diagnostics_channel";
 import { SeekdbClient } from "../../../src/client.js";
 import { getEmbeddedTestConfig, cleanupTestDb } from "../test-utils.js";
 import { SQLBuilder } from "../../../src/sql-builder.js";
+import type { LazyCell } from "../../../src/types.js";
 
 const TEST_CONFIG = getEmbeddedTestConfig("client-execute.test.ts");
 
@@ -48,6 +53,43 @@ describe("Embedded Mode - client.execute", () => {
     expect((rows as Record<string, unknown>[])[0]?.b).toBe("hello");
   });
 
+  test("execute rows are plain objects; a later duplicate column wins", async () => {
+    const rows = await client.execute("SELECT 1 AS a, 'x' AS b, 2 AS a");
+    expect(rows).toEqual([{ a: 2, b: "x" }]);
+    expect(Object.keys(rows![0])).toEqual(["a", "b"]);
+  });
+
+  test("execute with an aborted signal rejects with AbortError", async () => {
+    const pooled = new SeekdbClient({ ...TEST_CONFIG, pool: { max: 2 } });
+    try {
+      const controller = new AbortController();
+      controller.abort();
+      await expect(
+        pooled.execute("SELECT 1 AS a", [], { signal: controller.signal })
+      ).rejects.toMatchObject({ name: "AbortError" });
+      // Pool stays usable, also after a timeoutMs query restored the session timeout
+      const rows = await pooled.execute("SELECT 1 AS a", [], {
+        timeoutMs: 5000,
+      });
+      expect(rows).toEqual([{ a: 1 }]);
+      expect(await pooled.execute("SELECT 2 AS a")).toEqual([{ a: 2 }]);
+    } finally {
+      await pooled.close();
+    }
+  });
+
+  test("execute rejects signal and timeoutMs without a pool", async () => {
+    await expect(
+      client.execute("SELECT 1 AS a", [], { timeoutMs: 5000 })
+    ).rejects.toThrow(/Pool/);
+    await expect(
+      client.execute("SELECT 1 AS a", [], {
+        signal: new AbortController().signal,
+      })
+    ).rejects.toThrow(/Pool/);
+    expect(await client.execute("SELECT 2 AS a")).toEqual([{ a: 2 }]);
+  });
+
   test("execute DDL (CREATE TABLE, DROP TABLE)", async () => {
     const t = "exec_t_ddl";
     await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
@@ -97,6 +139,32 @@ describe("Embedded Mode - client.execute", () => {
     await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
   });
 
+  test("execute binds Buffer and Uint8Array params as binary", async () => {
+    const t = "exec_t_blob";
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.execute(
+      `CREATE TABLE \`${t}\` (id INT PRIMARY KEY, data BLOB) ORGANIZATION = HEAP`
+    );
+
+    const bytes = Buffer.from([0x00, 0xff, 0x10, 0x00, 0x7f]);
+    await client.execute(`INSERT INTO \`${t}\` (id, data) VALUES (?, ?)`, [
+      1,
+      bytes,
+    ]);
+    await client.execute(`INSERT INTO \`${t}\` (id, data) VALUES (?, ?)`, [
+      2,
+      new Uint8Array(bytes).subarray(1, 3),
+    ]);
+
+    const rows = (await client.execute(
+      `SELECT id, HEX(data) AS hex FROM \`${t}\` ORDER BY id`
+    )) as Record<string, unknown>[];
+    expect(rows[0]?.hex).toBe("00FF10007F");
+    expect(rows[1]?.hex).toBe("FF10");
+
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+  });
+
   test("execute UPDATE and SELECT returns updated data", async () => {
     const t = "exec_t_update";
     await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
@@ -175,6 +243,170 @@ describe("Embedded Mode - client.execute", () => {
     await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
   });
 
+  test("executeStream yields rows in batches of batchSize", async () => {
+    const t = "exec_t_stream";
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.execute(`
+      CREATE TABLE \`${t}\` (id INT PRIMARY KEY, name STRING) ORGANIZATION = HEAP
+    `);
+    for (let i = 1; i <= 5; i++) {
+      await client.execute(`INSERT INTO \`${t}\` (id, name) VALUES (?, ?)`, [
+        i,
+        `n${i}`,
+      ]);
+    }
+
+    const batches: number[] = [];
+    const ids: unknown[] = [];
+    for await (const batch of client.executeStream(
+      `SELECT id, name FROM \`${t}\` ORDER BY id`,
+      [],
+      { batchSize: 2 }
+    )) {
+      batches.push(batch.length);
+      ids.push(...batch.map((row) => row.id));
+    }
+    expect(batches).toEqual([2, 2, 1]);
+    expect(ids).toEqual([1, 2, 3, 4, 5]);
+
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+  });
+
+  test("executeRows returns array rows with field types", async () => {
+    const t = "exec_t_rows";
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.execute(`
+      CREATE TABLE \`${t}\` (id BIGINT PRIMARY KEY, name VARCHAR(32), score DOUBLE)
+    `);
+    const sql = `SELECT id, name, score FROM \`${t}\` ORDER BY id`;
+
+    const empty = await client.executeRows(sql);
+    expect(empty.columns).toEqual(["id", "name", "score"]);
+    expect(empty.fields?.map((field) => field.name)).toEqual(empty.columns);
+    expect([2, 3, 4]).toContain(empty.fields![0].type);
+    expect(empty.fields![2].type).toBe(6);
+    expect(empty.rows).toEqual([]);
+
+    await client.execute(
+      `INSERT INTO \`${t}\` (id, name, score) VALUES (1, 'a', 0.5), (2, 'b', 1.5)`
+    );
+    const result = await client.executeRows(sql);
+    expect(result.rows).toEqual([
+      [1, "a", 0.5],
+      [2, "b", 1.5],
+    ]);
+
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+  });
+
+  test("maxResultBytes bounds results and lazyColumns defers large cells", async () => {
+    const t = "exec_t_budget";
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.execute(`
+      CREATE TABLE \`${t}\` (id INT PRIMARY KEY, body TEXT) ORGANIZATION = HEAP
+    `);
+    for (let i = 1; i <= 5; i++) {
+      await client.execute(`INSERT INTO \`${t}\` (id, body) VALUES (?, ?)`, [
+        i,
+        "x".repeat(1000),
+      ]);
+    }
+    const sql = `SELECT id, body FROM \`${t}\` ORDER BY id`;
+
+    await expect(
+      client.execute(sql, [], { maxResultBytes: 2500 })
+    ).rejects.toThrow(/maxResultBytes/);
+    // The third row is the last one here and still crosses the budget
+    await expect(
+      client.execute(`${sql} LIMIT 3`, [], { maxResultBytes: 2500 })
+    ).rejects.toThrow(/maxResultBytes/);
+    expect(
+      await client.execute(`${sql} LIMIT 2`, [], { maxResultBytes: 2500 })
+    ).toHaveLength(2);
+
+    const batches: number[] = [];
+    for await (const batch of client.executeStream(sql, [], {
+      batchSize: 10,
+      maxResultBytes: 2500,
+    })) {
+      batches.push(batch.length);
+    }
+    expect(batches).toEqual([3, 2]);
+
+    const rows = await client.execute(sql, [], { lazyColumns: 500 });
+    const body = rows![0].body as LazyCell;
+    expect(body.byteLength).toBe(1000);
+    expect(body.read(10)).toBe("x".repeat(10));
+    expect(body.read()).toHaveLength(1000);
+
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+  });
+
+  test("executeBatch returns one result per statement", async () => {
+    const t = "exec_t_batch";
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    const insertSql = `INSERT INTO \`${t}\` (id, name) VALUES (?, ?)`;
+    const results = await client.executeBatch([
+      {
+        sql: `CREATE TABLE \`${t}\` (id INT PRIMARY KEY, name STRING) ORGANIZATION = HEAP`,
+      },
+      { sql: insertSql, params: [1, "a"] },
+      { sql: insertSql, params: [2, "b"] },
+      { sql: `SELECT COUNT(*) AS cnt FROM \`${t}\`` },
+    ]);
+    expect(results.length).toBe(4);
+    expect(Number(results[3]![0].cnt)).toBe(2);
+
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+  });
+
+  test("executeBatch transactional rolls back on failure", async () => {
+    const t = "exec_t_batch_tx";
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.execute(`
+      CREATE TABLE \`${t}\` (id INT PRIMARY KEY, name STRING) ORGANIZATION = HEAP
+    `);
+
+    const insertSql = `INSERT INTO \`${t}\` (id, name) VALUES (?, ?)`;
+    await expect(
+      client.executeBatch(
+        [
+          { sql: insertSql, params: [1, "a"] },
+          { sql: insertSql, params: [1, "dup"] },
+        ],
+        { transactional: true }
+      )
+    ).rejects.toThrow();
+    const rows = await client.execute(`SELECT COUNT(*) AS cnt FROM \`${t}\``);
+    expect(Number(rows![0].cnt)).toBe(0);
+
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+  });
+
+  test("queryStats counts queries and seekdb:query publishes timings", async () => {
+    expect(client.queryStats(true)).not.toBeNull();
+    const messages: { sql: string; timing: { rows: number; totalMs: number } }[] = [];
+    const onMessage = (message: unknown) => {
+      messages.push(message as (typeof messages)[number]);
+    };
+    subscribe("seekdb:query", onMessage);
+    try {
+      await client.execute("SELECT ? AS n", [1]);
+    } finally {
+      unsubscribe("seekdb:query", onMessage);
+    }
+    expect(messages).toHaveLength(1);
+    expect(messages[0].sql).toBe("SELECT ? AS n");
+    expect(messages[0].timing.rows).toBe(1);
+
+    const stats = client.queryStats()!;
+    expect(stats.queries).toBe(1);
+    expect(stats.rows).toBe(1);
+    expect(stats.total.count).toBe(1);
+    expect(stats.total.buckets.reduce((a, b) => a + b, 0)).toBe(1);
+    expect(stats.total.maxMs).toBeGreaterThanOrEqual(stats.engine.maxMs);
+  });
+
   test("hybrid search on table created by SQL (no collection API) returns rows", async () => {
     await client.execute(`DROP TABLE IF EXISTS \`${TABLE_HYBRID}\``);
 
@@ -1,6 +1,7 @@
 /**
  * Connection management tests for Embedded mode
- * Tests connection lifecycle, state management, and error handling for embedded mode
+ * Tests connection lifecycle, state management, and error handling for embedded mode,
+ * plus warmup, pooled transactions and group commit
  */
 
 import { describe, test, expect, beforeAll, afterAll } from "vitest";
@@ -66,4 +67,148 @@ describe("Embedded Mode - Connection Management", () => {
     await client.close(); // Second close should be safe
     await client.close(); // Third close should be safe
   });
+
+  test("shutdown() disconnects without closing the shared engine", async () => {
+    const first = new SeekdbClient(TEST_CONFIG);
+    const second = new SeekdbClient(TEST_CONFIG);
+    await first.listCollections();
+    await second.listCollections();
+
+    await first.shutdown();
+    expect(first.isConnected()).toBe(false);
+    // The other client keeps using the engine
+    const collections = await second.listCollections();
+    expect(Array.isArray(collections)).toBe(true);
+
+    await first.shutdown(); // Second shutdown is a no-op
+    await second.close();
+  });
+
+  test("pooled client runs concurrent queries and reports pool stats", async () => {
+    const client = new SeekdbClient({ ...TEST_CONFIG, pool: { max: 3 } });
+    expect(client.poolStats()).toBeNull();
+
+    const results = await Promise.all(
+      Array.from({ length: 6 }, (_, i) => client.execute("SELECT ? AS n", [i]))
+    );
+    expect(results.map((rows) => rows?.[0]?.n)).toEqual([0, 1, 2, 3, 4, 5]);
+
+    const stats = client.poolStats();
+    expect(stats).not.toBeNull();
+    expect(stats!.total).toBeGreaterThan(0);
+    expect(stats!.total).toBeLessThanOrEqual(3);
+    expect(stats!.inUse).toBe(0);
+    expect(stats!.acquired).toBeGreaterThanOrEqual(6);
+
+    await client.close();
+  });
+
+  test("warmup fills the pool and preloads collections", async () => {
+    const setup = new SeekdbClient(TEST_CONFIG);
+    const name = "conn_warmup";
+    if (await setup.hasCollection(name)) await setup.deleteCollection(name);
+    const created = await setup.createCollection({
+      name,
+      configuration: { dimension: 3, distance: "cosine" },
+      embeddingFunction: null,
+    });
+    await created.add({ ids: ["a"], embeddings: [[1, 2, 3]] });
+    await setup.close();
+
+    const client = new SeekdbClient({ ...TEST_CONFIG, pool: { max: 3 } });
+    await client.warmup({ collections: [name], connections: 2 });
+    expect(client.isConnected()).toBe(true);
+    const stats = client.poolStats()!;
+    expect(stats.total).toBeGreaterThanOrEqual(2);
+    expect(stats.inUse).toBe(0);
+
+    await expect(
+      client.warmup({ collections: ["conn_missing"] })
+    ).rejects.toThrow();
+    await client.deleteCollection(name);
+    await client.close();
+  });
+
+  test("pooled transaction pins one connection until commit or rollback", async () => {
+    const client = new SeekdbClient({ ...TEST_CONFIG, pool: { max: 2 } });
+    const t = "conn_t_tx";
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.execute(
+      `CREATE TABLE \`${t}\` (id INT PRIMARY KEY) ORGANIZATION = HEAP`
+    );
+    const count = async () => {
+      const rows = await client.execute(`SELECT COUNT(*) AS cnt FROM \`${t}\``);
+      return Number(rows![0].cnt);
+    };
+
+    const tx = await client.beginTransaction();
+    await tx.execute(`INSERT INTO \`${t}\` (id) VALUES (?)`, [1]);
+    // Other pooled connections do not see the uncommitted row
+    expect(await count()).toBe(0);
+    await tx.rollback();
+    expect(await count()).toBe(0);
+    await expect(tx.execute("SELECT 1")).rejects.toThrow(/finished/);
+
+    await client.transaction(async (inner) => {
+      await inner.executeBatch([
+        { sql: `INSERT INTO \`${t}\` (id) VALUES (?)`, params: [2] },
+        { sql: `INSERT INTO \`${t}\` (id) VALUES (?)`, params: [3] },
+      ]);
+    });
+    expect(await count()).toBe(2);
+    expect(client.poolStats()!.inUse).toBe(0);
+
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.close();
+  });
+
+  test("group commit requires a pool", () => {
+    expect(
+      () => new SeekdbClient({ ...TEST_CONFIG, groupCommit: true })
+    ).toThrow(/requires the pool/);
+  });
+
+  test("group commit merges concurrent writes and isolates failures", async () => {
+    const client = new SeekdbClient({
+      ...TEST_CONFIG,
+      pool: { max: 2 },
+      groupCommit: { maxStatements: 8 },
+    });
+    const t = "conn_t_group";
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.execute(
+      `CREATE TABLE \`${t}\` (id INT PRIMARY KEY) ORGANIZATION = HEAP`
+    );
+
+    const insert = `INSERT INTO \`${t}\` (id) VALUES (?)`;
+    const results = await Promise.allSettled(
+      [1, 2, 3, 3, 4].map((id) => client.execute(insert, [id]))
+    );
+    // Only one of the duplicates fails; the rest of the group is retried and committed
+    const rejected = results.filter((r) => r.status === "rejected");
+    expect(rejected).toHaveLength(1);
+    const rows = await client.execute(`SELECT COUNT(*) AS cnt FROM \`${t}\``);
+    expect(Number(rows![0].cnt)).toBe(4);
+
+    await client.execute(`DROP TABLE IF EXISTS \`${t}\``);
+    await client.close();
+  });
+
+  test("client with a native executor runs queries off the libuv threadpool", async () => {
+    const executor = { threads: 2, queueDepth: 64 };
+    const client = new SeekdbClient({ ...TEST_CONFIG, executor });
+    const results = await Promise.all(
+      Array.from({ length: 8 }, (_, i) => client.execute("SELECT ? AS n", [i]))
+    );
+    expect(results.map((rows) => rows?.[0]?.n)).toEqual([0, 1, 2, 3, 4, 5, 6, 7]);
+
+    // The executor is process-wide: the same options are accepted, different ones rejected
+    const same = new SeekdbClient({ ...TEST_CONFIG, executor });
+    expect(await same.execute("SELECT 1 AS n")).toEqual([{ n: 1 }]);
+    const other = new SeekdbClient({ ...TEST_CONFIG, executor: { threads: 3 } });
+    await expect(other.execute("SELECT 1 AS n")).rejects.toThrow(/already running/);
+
+    await client.close();
+    await same.close();
+  });
 });
@@ -5,7 +5,10 @@
 
 import { describe, test, expect, beforeAll, afterAll } from "vitest";
 import { SeekdbClient } from "../../../src/client.js";
-import { generateCollectionName } from "../../test-utils.js";
+import {
+  generateCollectionName,
+  Simple3DEmbeddingFunction,
+} from "../../test-utils.js";
 import { getEmbeddedTestConfig, cleanupTestDb } from "../test-utils.js";
 
 const TEST_CONFIG = getEmbeddedTestConfig("batch-operations.test.ts");
@@ -172,5 +175,114 @@ describe("Embedded Mode - Batch Operations", () => {
 
       await client.deleteCollection(collectionName);
     });
+
+    test("single add larger than one native chunk is all-or-nothing", async () => {
+      const collectionName = generateCollectionName("test_bulk_chunks");
+      const collection = await client.createCollection({
+        name: collectionName,
+        configuration: { dimension: 3, distance: "l2" },
+        embeddingFunction: null,
+      });
+
+      // More rows than the native bulk insert chunk (1000)
+      const totalCount = 2500;
+      const ids = Array.from({ length: totalCount }, (_, i) => `id_${i}`);
+      const embeddings = ids.map((_, i) => [i, i + 1, i + 2]);
+      await collection.add({
+        ids,
+        embeddings,
+        documents: ids.map((id) => `doc ${id}`),
+      });
+      expect(await collection.count()).toBe(totalCount);
+
+      // Duplicate id in the last chunk rolls back the earlier chunks too
+      const moreIds = Array.from({ length: 1500 }, (_, i) => `more_${i}`);
+      moreIds[moreIds.length - 1] = "id_0";
+      await expect(
+        collection.add({
+          ids: moreIds,
+          embeddings: moreIds.map(() => [0, 0, 0]),
+        })
+      ).rejects.toThrow();
+      expect(await collection.count()).toBe(totalCount);
+
+      const sample = await collection.get({
+        ids: ["id_1234"],
+        include: ["documents"],
+      });
+      expect(sample.documents?.[0]).toBe("doc id_1234");
+
+      await client.deleteCollection(collectionName);
+    });
+
+    test("addStream embeds chunks concurrently and inserts them all", async () => {
+      const base = Simple3DEmbeddingFunction();
+      let active = 0;
+      let maxActive = 0;
+      const ef = {
+        ...base,
+        async generate(texts: string[]) {
+          active++;
+          maxActive = Math.max(maxActive, active);
+          await new Promise((resolve) => setTimeout(resolve, 20));
+          active--;
+          return base.generate(texts);
+        },
+      };
+      const collectionName = generateCollectionName("test_add_stream");
+      const collection = await client.createCollection({
+        name: collectionName,
+        embeddingFunction: ef,
+      });
+
+      async function* records() {
+        for (let i = 0; i < 250; i++) {
+          yield { id: `s_${i}`, document: `streamed ${i}`, metadata: { i } };
+        }
+      }
+      const progress: number[] = [];
+      const result = await collection.addStream(records(), {
+        chunkSize: 40,
+        concurrency: 3,
+        onProgress: (p) => progress.push(p.inserted),
+      });
+
+      expect(result).toEqual({ inserted: 250, chunks: 7 });
+      expect(progress).toEqual([40, 80, 120, 160, 200, 240, 250]);
+      expect(maxActive).toBeGreaterThan(1);
+      expect(maxActive).toBeLessThanOrEqual(3);
+      expect(await collection.count()).toBe(250);
+
+      await client.deleteCollection(collectionName);
+    });
+
+    test("addStream settles launched chunks before a source error", async () => {
+      const base = Simple3DEmbeddingFunction();
+      const ef = {
+        ...base,
+        async generate(texts: string[]) {
+          await new Promise((resolve) => setTimeout(resolve, 20));
+          return base.generate(texts);
+        },
+      };
+      const collectionName = generateCollectionName("test_add_stream_err");
+      const collection = await client.createCollection({
+        name: collectionName,
+        embeddingFunction: ef,
+      });
+
+      async function* records() {
+        for (let i = 0; i < 80; i++) {
+          yield { id: `e_${i}`, document: `streamed ${i}` };
+        }
+        throw new Error("source failed");
+      }
+      await expect(
+        collection.addStream(records(), { chunkSize: 40, concurrency: 3 })
+      ).rejects.toThrow("source failed");
+      expect(await collection.count()).toBe(80);
+
+      await client.deleteCollection(collectionName);
+    });
   });
 });
@@ -488,6 +488,44 @@ describe("Embedded Mode - Collection DML Operations", () => {
       expect(results.documents![1]).toBe("Upsert doc 2");
     });
 
+    test("collection.upsert - mixed batch keeps fields that are not provided", async () => {
+      await collection.upsert({
+        ids: ["test_id_upsert_1", "test_id_upsert_3"],
+        embeddings: [
+          [84.0, 85.0, 86.0],
+          [85.0, 86.0, 87.0],
+        ],
+        documents: ["Upsert doc 1 v2", "Upsert doc 3"],
+      });
+
+      const results = await collection.get({
+        ids: ["test_id_upsert_1", "test_id_upsert_3"],
+      });
+      const byId = new Map(results.ids.map((id, i) => [id, i]));
+      const existing = byId.get("test_id_upsert_1")!;
+      const inserted = byId.get("test_id_upsert_3")!;
+      expect(results.documents![existing]).toBe("Upsert doc 1 v2");
+      expect(results.metadatas![existing]?.type).toBe("upsert");
+      expect(results.embeddings![existing]).toEqual([84.0, 85.0, 86.0]);
+      expect(results.documents![inserted]).toBe("Upsert doc 3");
+      expect(results.metadatas![inserted]).toBeNull();
+
+      // Metadata-only upserts can only touch existing rows
+      await expect(
+        collection.upsert({
+          ids: ["test_id_upsert_2", "test_id_upsert_missing"],
+          metadatas: [{ type: "again" }, { type: "again" }],
+        })
+      ).rejects.toThrow(SeekdbValueError);
+      await collection.upsert({
+        ids: "test_id_upsert_2",
+        metadatas: { type: "again" },
+      });
+      const updated = await collection.get({ ids: "test_id_upsert_2" });
+      expect(updated.metadatas![0]?.type).toBe("again");
+      expect(updated.documents![0]).toBe("Upsert doc 2");
+    });
+
     test("collection.add - throws error for duplicate ID", async () => {
       const testId = "test_id_duplicate";
 
@@ -183,6 +183,42 @@ describe("Embedded Mode - Collection Hybrid Search Operations", () => {
       });
     });
 
+    test("hybrid search with the SQL cache matches uncached results", async () => {
+      await runHybridSearchTest(async () => {
+        const cachedClient = new SeekdbClient({
+          ...TEST_CONFIG,
+          hybridSearchCache: 16,
+        });
+        try {
+          const cachedCollection = await cachedClient.getCollection({
+            name: collectionName,
+          });
+          const search = (text: string, vector: number[]) => ({
+            query: { whereDocument: { $contains: text }, nResults: 10 },
+            knn: { queryEmbeddings: vector, nResults: 10 },
+            nResults: 5,
+          });
+          // First search learns the shape, the later ones render from the cache
+          for (const [text, vector] of [
+            ["machine learning", [1.0, 2.0, 3.0]],
+            ["python", [2.0, 3.0, 4.0]],
+            ["neural networks", [1.1, 2.1, 3.1]],
+          ] as [string, number[]][]) {
+            const cached = await cachedCollection.hybridSearch(
+              search(text, vector)
+            );
+            const uncached = await collection.hybridSearch(
+              search(text, vector)
+            );
+            expect(cached.ids).toEqual(uncached.ids);
+            expect(cached.distances).toEqual(uncached.distances);
+          }
+        } finally {
+          await cachedClient.close();
+        }
+      });
+    });
+
     test("hybrid search with metadata filter", async () => {
       await runHybridSearchTest(async () => {
         const results = await collection.hybridSearch({
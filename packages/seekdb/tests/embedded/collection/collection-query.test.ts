@@ -17,6 +17,7 @@ import {
 } from "../../../src/schema.js";
 import { K } from "../../../src/key.js";
 import { SeekdbValueError } from "../../../src/errors.js";
+import { vectorDistances } from "../../../src/vector-kernels.js";
 import { registerSparseEmbeddingFunction } from "../../../src/embedding-function.js";
 import type {
   EmbeddingConfig,
@@ -214,6 +215,51 @@ describe("Embedded Mode - Collection Query Operations", () => {
       }
     });
 
+    test("multi-vector query on a pooled client matches per-vector queries", async () => {
+      const pooled = new SeekdbClient({ ...TEST_CONFIG, pool: { max: 2 } });
+      try {
+        const pooledCollection = await pooled.getCollection({
+          name: collectionName,
+        });
+        const vectors = [
+          [1.0, 2.0, 3.0],
+          [2.0, 3.0, 4.0],
+          [1.2, 2.2, 3.2],
+          [2.1, 3.1, 4.1],
+          [1.1, 2.1, 3.1],
+        ];
+        const batch = await pooledCollection.query({
+          queryEmbeddings: vectors,
+          nResults: 2,
+        });
+        expect(batch.ids).toHaveLength(vectors.length);
+        for (let i = 0; i < vectors.length; i++) {
+          const single = await collection.query({
+            queryEmbeddings: vectors[i],
+            nResults: 2,
+          });
+          expect(batch.ids[i]).toEqual(single.ids[0]);
+          expect(batch.distances![i]).toEqual(single.distances![0]);
+        }
+      } finally {
+        await pooled.close();
+      }
+    });
+
+    test("vectorDistances rescores query() results with the engine's distances", async () => {
+      const queryVector = [1.0, 2.0, 3.0];
+      const results = await collection.query({
+        queryEmbeddings: queryVector,
+        nResults: 5,
+        include: ["embeddings", "distances"],
+      });
+      const embeddings = results.embeddings![0] as number[][];
+      const rescored = vectorDistances("l2", queryVector, embeddings);
+      rescored.forEach((distance, i) => {
+        expect(distance).toBeCloseTo(results.distances![0][i]!, 4);
+      });
+    });
+
     test("single vector returns dict format", async () => {
       const queryVector = [1.0, 2.0, 3.0];
       const results = await collection.query({
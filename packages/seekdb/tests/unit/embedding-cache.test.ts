@@ -0,0 +1,111 @@
+/**
+ * Unit tests for EmbeddingCache and withEmbeddingCache()
+ */
+
+import { describe, test, expect } from "vitest";
+import {
+  EmbeddingCache,
+  withEmbeddingCache,
+  supportsPersistence,
+} from "../../src/embedding-function.js";
+import type { EmbeddingFunction } from "../../src/types.js";
+
+class CountingEmbeddingFunction implements EmbeddingFunction {
+  readonly name = "counting";
+  dimension = 2;
+  calls: string[][] = [];
+
+  constructor(private readonly config: Record<string, unknown> = {}) {}
+
+  async generate(texts: string[]): Promise<number[][]> {
+    this.calls.push(texts);
+    await new Promise((resolve) => setTimeout(resolve, 5));
+    return texts.map((text) => [text.length, 0.1]);
+  }
+
+  getConfig() {
+    return this.config;
+  }
+
+  static buildFromConfig(config: Record<string, unknown>) {
+    return new CountingEmbeddingFunction(config);
+  }
+}
+
+describe("EmbeddingCache", () => {
+  test("generates each text once and serves repeats from the cache", async () => {
+    const inner = new CountingEmbeddingFunction();
+    const ef = withEmbeddingCache(inner, { maxEntries: 10 });
+
+    const first = await ef.generate(["a", "bb", "a"]);
+    expect(inner.calls).toEqual([["a", "bb"]]);
+    // Vectors come back at float32 precision, hit or miss
+    expect(first).toEqual([
+      [1, Math.fround(0.1)],
+      [2, Math.fround(0.1)],
+      [1, Math.fround(0.1)],
+    ]);
+
+    expect(await ef.generate(["bb", "ccc"])).toEqual([
+      [2, Math.fround(0.1)],
+      [3, Math.fround(0.1)],
+    ]);
+    expect(inner.calls).toEqual([["a", "bb"], ["ccc"]]);
+    expect(ef.cache.stats()).toEqual({ size: 3, hits: 2, misses: 3 });
+  });
+
+  test("coalesces concurrent requests for the same text", async () => {
+    const inner = new CountingEmbeddingFunction();
+    const ef = withEmbeddingCache(inner);
+
+    const results = await Promise.all([
+      ef.generate(["q"]),
+      ef.generate(["q"]),
+      ef.generate(["q", "r"]),
+    ]);
+    expect(inner.calls).toEqual([["q"], ["r"]]);
+    expect(results[0]).toEqual(results[1]);
+  });
+
+  test("evicts the least recently used vector", async () => {
+    const inner = new CountingEmbeddingFunction();
+    const ef = withEmbeddingCache(inner, { maxEntries: 2 });
+
+    await ef.generate(["a", "b"]);
+    await ef.generate(["a"]);
+    await ef.generate(["c"]);
+    await ef.generate(["a", "b"]);
+    expect(inner.calls).toEqual([["a", "b"], ["c"], ["b"]]);
+  });
+
+  test("keys on config and keeps the wrapped function persistable", async () => {
+    const cache = new EmbeddingCache();
+    const small = new CountingEmbeddingFunction({ model: "small" });
+    const large = new CountingEmbeddingFunction({ model: "large" });
+
+    await withEmbeddingCache(small, cache).generate(["x"]);
+    await withEmbeddingCache(large, cache).generate(["x"]);
+    expect(large.calls).toEqual([["x"]]);
+
+    const ef = withEmbeddingCache(small, cache);
+    expect(ef.name).toBe("counting");
+    expect(ef.dimension).toBe(2);
+    expect(ef.getConfig()).toEqual({ model: "small" });
+    expect(supportsPersistence(ef)).toBe(true);
+  });
+
+  test("does not cache failed generations", async () => {
+    let fail = true;
+    const inner = new CountingEmbeddingFunction();
+    const generate = inner.generate.bind(inner);
+    inner.generate = async (texts) => {
+      if (fail) throw new Error("unavailable");
+      return generate(texts);
+    };
+    const ef = withEmbeddingCache(inner);
+
+    await expect(ef.generate(["a"])).rejects.toThrow("unavailable");
+    fail = false;
+    expect(await ef.generate(["a"])).toEqual([[1, Math.fround(0.1)]]);
+  });
+});
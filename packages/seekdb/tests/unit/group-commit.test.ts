@@ -0,0 +1,106 @@
+/**
+ * Unit tests for GroupCommitQueue
+ */
+
+import { describe, test, expect } from "vitest";
+import { GroupCommitQueue } from "../../src/group-commit.js";
+
+class FakeTransaction {
+  writes: string[] = [];
+  committed = false;
+  rolledBack = false;
+
+  constructor(private readonly failCommit = false) {}
+
+  async commit(): Promise<void> {
+    await new Promise((resolve) => setTimeout(resolve, 5));
+    if (this.failCommit) throw new Error("commit failed");
+    this.committed = true;
+  }
+
+  async rollback(): Promise<void> {
+    this.rolledBack = true;
+  }
+}
+
+function write(log: string[], name: string, fail = false) {
+  return async (tx: FakeTransaction | null) => {
+    if (fail) throw new Error(`${name} failed`);
+    (tx?.writes ?? log).push(name);
+    return name;
+  };
+}
+
+describe("GroupCommitQueue", () => {
+  test("merges concurrent writes into one transaction per group", async () => {
+    const transactions: FakeTransaction[] = [];
+    const queue = new GroupCommitQueue(async () => {
+      transactions.push(new FakeTransaction());
+      return transactions[transactions.length - 1];
+    });
+    const autocommit: string[] = [];
+
+    const first = await Promise.all(
+      ["a", "b", "c"].map((name) => queue.run(write(autocommit, name)))
+    );
+    expect(first).toEqual(["a", "b", "c"]);
+    expect(transactions).toHaveLength(1);
+    expect(transactions[0].writes).toEqual(["a", "b", "c"]);
+    expect(transactions[0].committed).toBe(true);
+
+    // A write that is alone in its group skips the transaction
+    expect(await queue.run(write(autocommit, "d"))).toBe("d");
+    expect(autocommit).toEqual(["d"]);
+    expect(transactions).toHaveLength(1);
+  });
+
+  test("writes queued during a commit form the next group", async () => {
+    const transactions: FakeTransaction[] = [];
+    const queue = new GroupCommitQueue(
+      async () => {
+        transactions.push(new FakeTransaction());
+        return transactions[transactions.length - 1];
+      },
+      { maxStatements: 2 }
+    );
+
+    const results = await Promise.all(
+      ["a", "b", "c", "d"].map((name) => queue.run(write([], name)))
+    );
+    expect(results).toEqual(["a", "b", "c", "d"]);
+    expect(transactions.map((tx) => tx.writes)).toEqual([
+      ["a", "b"],
+      ["c", "d"],
+    ]);
+  });
+
+  test("retries a failed group write by write", async () => {
+    const tx = new FakeTransaction();
+    const queue = new GroupCommitQueue(async () => tx);
+    const autocommit: string[] = [];
+
+    const results = await Promise.allSettled([
+      queue.run(write(autocommit, "a")),
+      queue.run(write(autocommit, "b", true)),
+    ]);
+    expect(results[0]).toEqual({ status: "fulfilled", value: "a" });
+    expect(results[1]).toMatchObject({
+      status: "rejected",
+      reason: expect.objectContaining({ message: "b failed" }),
+    });
+    expect(tx.rolledBack).toBe(true);
+    expect(autocommit).toEqual(["a"]);
+  });
+
+  test("retries the group when its commit fails", async () => {
+    const queue = new GroupCommitQueue(async () => new FakeTransaction(true));
+    const autocommit: string[] = [];
+
+    const results = await Promise.all([
+      queue.run(write(autocommit, "a")),
+      queue.run(write(autocommit, "b")),
+    ]);
+    expect(results).toEqual(["a", "b"]);
+    expect(autocommit).toEqual(["a", "b"]);
+  });
+});
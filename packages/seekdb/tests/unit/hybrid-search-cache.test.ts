@@ -0,0 +1,59 @@
+/**
+ * Unit tests for HybridSearchSqlCache, against a stand-in for DBMS_HYBRID_SEARCH.GET_SQL
+ */
+
+import { describe, test, expect } from "vitest";
+import { HybridSearchSqlCache } from "../../src/hybrid-search-cache.js";
+
+function getSql(parm: any): string {
+  const text = parm.query?.query_string?.query;
+  const vector = parm.knn?.query_vector;
+  let sql = "SELECT _id, document FROM t";
+  if (text !== undefined) {
+    sql += ` WHERE MATCH(document) AGAINST('${text.replace(/'/g, "\\'")}')`;
+  }
+  if (vector) {
+    sql += ` ORDER BY l2_distance(embedding, '[${vector.join(", ")}]')`;
+  }
+  return `${sql} LIMIT ${parm.size}`;
+}
+
+function searchParm(text: string, vector: number[], size = 3) {
+  return {
+    query: { query_string: { fields: ["document"], query: text } },
+    knn: { field: "embedding", k: 5, query_vector: vector },
+    size,
+  };
+}
+
+describe("HybridSearchSqlCache", () => {
+  test("renders parms of a learned shape without generating SQL", async () => {
+    const cache = new HybridSearchSqlCache(8);
+    const first = searchParm("vector search", [0.1, 0.25, 3]);
+    expect(cache.get("t", first)).toBeNull();
+
+    let generated = 0;
+    await cache.learn("t", first, getSql(first), async (parm) => {
+      generated++;
+      return getSql(parm);
+    });
+    expect(generated).toBe(1);
+
+    const second = searchParm("hybrid ranking", [1.5, -2, 1e-7]);
+    expect(cache.get("t", second)).toBe(getSql(second));
+    // Other shapes, tables and strings that need escaping miss
+    expect(cache.get("t", searchParm("x", [1, 2, 3], 4))).toBeNull();
+    expect(cache.get("t", searchParm("x", [1, 2]))).toBeNull();
+    expect(cache.get("other", second)).toBeNull();
+    expect(cache.get("t", searchParm("it's", [1, 2, 3]))).toBeNull();
+  });
+
+  test("does not cache shapes whose SQL the template cannot reproduce", async () => {
+    const cache = new HybridSearchSqlCache(8);
+    const parm = searchParm("vector search", [0.1, 0.2, 0.3]);
+    // Rewrites the values, so sentinels do not show up verbatim
+    const rewritten = (p: any) => getSql(p).toUpperCase();
+    await cache.learn("t", parm, rewritten(parm), async (p) => rewritten(p));
+    expect(cache.get("t", searchParm("other", [1, 2, 3]))).toBeNull();
+  });
+});
@@ -283,6 +283,62 @@ describe("SQLBuilder.buildInsert", () => {
     });
     expect(params[params.length - 1]).toBeNull();
   });
+
+  test("passes vectors as JSON strings by default", () => {
+    const { params } = SQLBuilder.buildInsert(CTX, {
+      ids: ["id1"],
+      embeddings: [[1, 2, 3]],
+    });
+    expect(params[3]).toBe("[1,2,3]");
+  });
+
+  test("passes vectors as Float32Array when vectorFormat is float32", () => {
+    const { params } = SQLBuilder.buildInsert(
+      { ...CTX, vectorFormat: "float32" },
+      { ids: ["id1"], embeddings: [[1, 2.5, 3]] }
+    );
+    expect(params[3]).toBeInstanceOf(Float32Array);
+    expect(Array.from(params[3] as Float32Array)).toEqual([1, 2.5, 3]);
+  });
+});
+
+describe("SQLBuilder.buildBulkInsert", () => {
+  test("returns one data array per column", () => {
+    const { columns, data } = SQLBuilder.buildBulkInsert(CTX, {
+      ids: ["id1", "id2"],
+      embeddings: [
+        [1, 2, 3],
+        [4, 5, 6],
+      ],
+      documents: ["doc", null],
+      metadatas: [{ k: "v" }, null],
+    });
+    expect(columns.map((c) => c.name)).toEqual([
+      "_id",
+      "document",
+      "metadata",
+      "embedding",
+    ]);
+    expect(columns[0].binaryId).toBe(true);
+    expect(data[0]).toEqual(["id1", "id2"]);
+    expect(data[1]).toEqual(["doc", null]);
+    expect(data[2][1]).toBeNull();
+    expect(data[3]).toEqual(["[1,2,3]", "[4,5,6]"]);
+  });
+
+  test("adds sparse embedding column when provided", () => {
+    const { columns, data } = SQLBuilder.buildBulkInsert(
+      { ...CTX, vectorFormat: "float32" },
+      {
+        ids: ["id1"],
+        embeddings: [[1, 2, 3]],
+        sparseEmbeddings: [null],
+      }
+    );
+    expect(columns.length).toBe(5);
+    expect(data[3][0]).toBeInstanceOf(Float32Array);
+    expect(data[4]).toEqual([null]);
+  });
 });
 
 describe("SQLBuilder.buildUpdate", () => {
@@ -315,6 +371,14 @@ describe("SQLBuilder.buildUpdate", () => {
     expect(sql).toContain("sparse_embedding = ?");
     expect(params[0]).toBeNull();
   });
+
+  test("passes embedding as Float32Array when vectorFormat is float32", () => {
+    const { params } = SQLBuilder.buildUpdate(
+      { ...CTX, vectorFormat: "float32" },
+      { id: "id1", updates: { embedding: [1, 2] } }
+    );
+    expect(params[0]).toBeInstanceOf(Float32Array);
+  });
 });
 
 describe("SQLBuilder.buildDelete", () => {
@@ -21,6 +21,8 @@ import {
   deserializeMetadata,
   escapeSqlString,
   vectorToSqlString,
+  vectorToFloat32Array,
+  parseVectorValue,
   CollectionNames,
   CollectionFieldNames,
   TABLE_NAME_COLUMNS,
@@ -592,6 +594,33 @@ describe("Utility Functions", () => {
     });
   });
 
+  describe("vectorToFloat32Array", () => {
+    test("converts vector to Float32Array", () => {
+      const vec = vectorToFloat32Array([1, 2.5, 3]);
+      expect(vec).toBeInstanceOf(Float32Array);
+      expect(Array.from(vec)).toEqual([1, 2.5, 3]);
+    });
+
+    test("throws for non-finite values", () => {
+      expect(() => vectorToFloat32Array([1, NaN])).toThrow(SeekdbValueError);
+      expect(() => vectorToFloat32Array([Infinity])).toThrow(
+        SeekdbValueError
+      );
+    });
+  });
+
+  describe("parseVectorValue", () => {
+    test("parses JSON string and Float32Array values", () => {
+      expect(parseVectorValue("[1,2,3]")).toEqual([1, 2, 3]);
+      expect(parseVectorValue(new Float32Array([1, 0.5]))).toEqual([1, 0.5]);
+    });
+
+    test("returns null for empty values", () => {
+      expect(parseVectorValue(null)).toBeNull();
+      expect(parseVectorValue("")).toBeNull();
+    });
+  });
+
   describe("CollectionNames", () => {
     test("generates table name", () => {
       expect(CollectionNames.tableName("test")).toBe("c$v1$test");
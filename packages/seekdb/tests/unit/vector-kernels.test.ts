@@ -0,0 +1,49 @@
+/**
+ * Unit tests for normalizeVectors() and vectorDistances() (JS path: the
+ * native addon is not loaded in unit tests)
+ */
+
+import { describe, test, expect } from "vitest";
+import {
+  normalizeVectors,
+  vectorDistances,
+} from "../../src/vector-kernels.js";
+import { SeekdbValueError } from "../../src/errors.js";
+
+describe("vector kernels", () => {
+  test("normalizeVectors scales to unit norm and keeps zero vectors", () => {
+    const [unit, zero] = normalizeVectors([
+      [3, 4],
+      [0, 0],
+    ]);
+    expect(unit[0]).toBeCloseTo(0.6);
+    expect(unit[1]).toBeCloseTo(0.8);
+    expect(zero).toEqual([0, 0]);
+  });
+
+  test("vectorDistances follows the engine's distance functions", () => {
+    const query = [1, 0];
+    const vectors = [
+      [1, 0],
+      [0, 2],
+      [-1, 0],
+    ];
+    expect(vectorDistances("l2", query, vectors)).toEqual([0, Math.sqrt(5), 2]);
+    expect(vectorDistances("inner_product", query, vectors)).toEqual([
+      1, 0, -1,
+    ]);
+    expect(vectorDistances("cosine", query, vectors)).toEqual([0, 1, 2]);
+    expect(vectorDistances("cosine", query, [[0, 0]])[0]).toBeNaN();
+  });
+
+  test("vectorDistances accepts a concatenated Float32Array batch", () => {
+    const batch = new Float32Array([1, 0, 0, 2, -1, 0]);
+    expect(vectorDistances("l2", [1, 0], batch)).toEqual([0, Math.sqrt(5), 2]);
+    expect(() => vectorDistances("l2", [1, 0, 0], batch.subarray(0, 4))).toThrow(
+      SeekdbValueError
+    );
+    expect(() => vectorDistances("l2", [1, 0], [[1, 0, 0]])).toThrow(
+      SeekdbValueError
+    );
+  });
+});
@@ -0,0 +1,15 @@
+import { defineConfig, mergeConfig } from "vitest/config";
+import vitestConfig from "./vitest.config.ts";
+
+// `pnpm bench`: runs bench/*.perf.ts against an embedded instance, one results file per run
+export default mergeConfig(
+  vitestConfig,
+  defineConfig({
+    test: {
+      include: ["bench/**/*.perf.ts"],
+      testTimeout: 1800000,
+      hookTimeout: 1800000,
+      env: { SEEKDB_BENCH_RUN: new Date().toISOString() },
+    },
+  })
+);